@@ -8,6 +8,39 @@
 #include <sstream>
 #include <cstring>
 #include <exception>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string_view>
+#include <mutex>
+#include <condition_variable>
+#include <list>
+#include <deque>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UEPARSER_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#endif
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
 #include "json.hpp"
 
 using json = nlohmann::json;
@@ -35,16 +68,20 @@ struct ThumbnailIndex {
 	int32_t FileOffset;
 };
 
+// Image bytes are not read during parse; ImageDataOffset locates them in the file
+// and Uasset::loadThumbnail() fills ImageData on demand
 struct Thumbnail {
 	int32_t ImageWidth;
 	int32_t ImageHeight;
 	std::string ImageFormat;
 	int32_t ImageSizeData;
+	int64_t ImageDataOffset;
 	std::vector<uint8_t> ImageData;
 };
 
+// Tag keys repeat across every entry, so they are interned per asset into AssetRegistryData::Keys
 struct Tag {
-	std::string Key;
+	uint32_t KeyId;
 	std::string Value;
 };
 
@@ -57,9 +94,67 @@ struct AssetRegistryEntry {
 struct AssetRegistryData {
 	int64_t DependencyDataOffset;
 	int32_t size;
+	std::vector<std::string> Keys;
 	std::vector<AssetRegistryEntry> data;
+
+	const std::string& key(const Tag& tag) const { return Keys[tag.KeyId]; }
+};
+
+// FName hashes saved after each name table string. NonCasePreservingHash is the low 16 bits
+// of FCrc::Strihash_DEPRECATED: the name with ASCII letters upper-cased, run through
+// CRCTable_DEPRECATED (an MSB-first CRC-32 table that UE indexes with a right-shifting
+// update). CasePreservingHash is the low 16 bits of FCrc::StrCrc32, a standard CRC-32 over
+// the name with every character widened to four bytes.
+struct NameHashTables {
+	uint32_t deprecated[256];
+	uint32_t crc[4][256];   // crc[k][b]: byte b followed by k zero bytes, so a widened character is one step
+
+	NameHashTables() {
+		for (uint32_t i = 0; i < 256; ++i) {
+			uint32_t msbFirst = i << 24;
+			uint32_t reflected = i;
+			for (int bit = 0; bit < 8; ++bit) {
+				msbFirst = (msbFirst & 0x80000000) ? (msbFirst << 1) ^ 0x04C11DB7 : msbFirst << 1;
+				reflected = (reflected & 1) ? (reflected >> 1) ^ 0xEDB88320 : reflected >> 1;
+			}
+			deprecated[i] = msbFirst;
+			crc[0][i] = reflected;
+		}
+		for (int k = 1; k < 4; ++k) {
+			for (uint32_t i = 0; i < 256; ++i) {
+				crc[k][i] = (crc[k - 1][i] >> 8) ^ crc[0][crc[k - 1][i] & 0xFF];
+			}
+		}
+	}
+
+	static const NameHashTables& get() {
+		static const NameHashTables tables;
+		return tables;
+	}
+
+	// One character of both hashes; upper is c with ASCII letters upper-cased
+	void step(uint8_t c, uint8_t upper, uint32_t& nonCasePreserving, uint32_t& casePreserving) const {
+		nonCasePreserving = (nonCasePreserving >> 8) ^ deprecated[(nonCasePreserving ^ upper) & 0xFF];
+		casePreserving ^= c;
+		casePreserving = crc[3][casePreserving & 0xFF] ^ crc[2][(casePreserving >> 8) & 0xFF] ^
+			crc[1][(casePreserving >> 16) & 0xFF] ^ crc[0][casePreserving >> 24];
+	}
 };
 
+// Both hashes UE saves for a name. Bytes are taken as unsigned, so only ASCII names are
+// guaranteed to match what the engine wrote.
+void computeNameHashes(const std::string& name, uint16_t& nonCasePreserving, uint16_t& casePreserving) {
+	const NameHashTables& tables = NameHashTables::get();
+	uint32_t nonCase = 0;
+	uint32_t crc = 0xFFFFFFFF;
+	for (char ch : name) {
+		uint8_t c = static_cast<uint8_t>(ch);
+		tables.step(c, c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c, nonCase, crc);
+	}
+	nonCasePreserving = static_cast<uint16_t>(nonCase);
+	casePreserving = static_cast<uint16_t>(~crc);
+}
+
 struct UassetData {
 	struct Header {
 		uint32_t EPackageFileTag;
@@ -111,6 +206,29 @@ struct UassetData {
 		int32_t EngineChangelist;
 	} header;
 
+	// File positions of the summary fields UassetWriter rewrites (0 = field not present)
+	struct SummaryLayout {
+		size_t end = 0;
+		size_t namesEnd = 0;
+		size_t TotalHeaderSize = 0;
+		size_t NameCount = 0;
+		size_t NameOffset = 0;
+		size_t SoftObjectPathsOffset = 0;
+		size_t GatherableTextDataOffset = 0;
+		size_t ExportOffset = 0;
+		size_t ImportOffset = 0;
+		size_t DependsOffset = 0;
+		size_t SoftPackageReferencesOffset = 0;
+		size_t SearchableNamesOffset = 0;
+		size_t ThumbnailTableOffset = 0;
+		size_t AssetRegistryDataOffset = 0;
+		size_t BulkDataStartOffset = 0;
+		size_t WorldTileInfoDataOffset = 0;
+		size_t PreloadDependencyOffset = 0;
+		size_t PayloadTocOffset = 0;
+		size_t DataResourceOffset = 0;
+	} summaryLayout;
+
 	struct Import {
 		std::string classPackage;
 		std::string className;
@@ -133,6 +251,7 @@ struct UassetData {
 		int32_t bNotForClient;
 		int32_t bNotForServer;
 		std::string packageGuid;
+		int32_t bIsInheritedInstance;
 		uint32_t packageFlags;
 		int32_t bNotAlwaysLoadedForEditorGame;
 		int32_t bIsAsset;
@@ -142,6 +261,8 @@ struct UassetData {
 		int32_t createBeforeSerializationDependencies;
 		int32_t serializationBeforeCreateDependencies;
 		int32_t createBeforeCreateDependencies;
+		int64_t scriptSerializationStartOffset;
+		int64_t scriptSerializationEndOffset;
 		std::vector<std::string> data;
 		std::vector<uint8_t> chunkData;
 
@@ -154,19 +275,25 @@ struct UassetData {
 			std::string PropertyName;
 			std::string PropertyType;
 
-			int intValue;
-			float floatValue;
-			bool boolValue;
+			int intValue = 0;
+			float floatValue = 0;
+			bool boolValue = false;
 			std::string stringValue;
 			std::vector<uint8_t> byteBuffer; 
 
+			// File location of a fixed-size value (bool, int, float, GUID); -1 if unknown
+			int64_t valueOffset = -1;
+			uint32_t valueSize = 0;
+
 			Property() : PropertyName(""), PropertyType("") {}
 			~Property() {}
 
 			// Copy constructor
 			Property(const Property& other) : PropertyName(other.PropertyName), 
 				PropertyType(other.PropertyType) , 
-				byteBuffer(other.byteBuffer) {
+				byteBuffer(other.byteBuffer),
+				valueOffset(other.valueOffset),
+				valueSize(other.valueSize) {
 				if (PropertyType == "int") {
 					intValue = other.intValue;
 				}
@@ -190,6 +317,8 @@ struct UassetData {
 				PropertyName = other.PropertyName;
 				PropertyType = other.PropertyType;
 				byteBuffer = other.byteBuffer;
+				valueOffset = other.valueOffset;
+				valueSize = other.valueSize;
 
 				if (PropertyType == "int") {
 					intValue = other.intValue;
@@ -206,11 +335,110 @@ struct UassetData {
 
 				return *this;
 			}
+
+			// Move constructor; lets property vectors grow and be recycled without copying
+			// strings. Everything moves, buffers included, so a recycled property keeps them.
+			Property(Property&& other) noexcept : PropertyName(std::move(other.PropertyName)),
+				PropertyType(std::move(other.PropertyType)),
+				intValue(other.intValue),
+				floatValue(other.floatValue),
+				boolValue(other.boolValue),
+				stringValue(std::move(other.stringValue)),
+				byteBuffer(std::move(other.byteBuffer)),
+				valueOffset(other.valueOffset),
+				valueSize(other.valueSize) {}
 		};
 
 		std::vector<Property> properties;
 		int internalIndex;
 
+		// Set by editors that replaced chunkData; UassetWriter copies other bodies from the source file
+		bool bodyModified = false;
+
+		// Which tag consumed each byte range of the body, in file order. Filled by readExportData
+		// when ParseOptions::coverage is set; adjacent runs of one kind and tag are merged.
+		enum class Coverage : uint8_t { Decoded, Skipped, Unknown };
+		struct CoverageRun {
+			uint32_t offset;   // from serialOffset
+			uint32_t length;
+			Coverage kind;
+			std::string tag;   // handler for decoded and skipped runs, first unclaimed FName for unknown ones
+		};
+		std::vector<CoverageRun> coverage;
+
+		// Empties the export for another parse (see Uasset::reset()); strings and vectors keep
+		// their capacity. The record fields are all rewritten by Uasset::fillExportRecord.
+		void clear() {
+			objectName.clear();
+			packageGuid.clear();
+			data.clear();
+			chunkData.clear();
+			metadata.ObjectName.clear();
+			metadata.ObjectType.clear();
+			properties.clear();
+			bodyModified = false;
+			coverage.clear();
+		}
+	};
+
+	// Export map decoded in one batch, one array per field (entry i is export i + 1).
+	// Scans over class indices or serial offsets walk contiguous memory instead of Export structs.
+	struct ExportMap {
+		std::vector<int32_t> classIndex;
+		std::vector<int32_t> superIndex;
+		std::vector<int32_t> templateIndex;
+		std::vector<int32_t> outerIndex;
+		std::vector<int32_t> objectNameIndex;
+		std::vector<int32_t> objectNameNumber;
+		std::vector<uint32_t> objectFlags;
+		std::vector<int64_t> serialSize;
+		std::vector<int64_t> serialOffset;
+		std::vector<int32_t> bForcedExport;
+		std::vector<int32_t> bNotForClient;
+		std::vector<int32_t> bNotForServer;
+		std::vector<std::string> packageGuid;
+		std::vector<int32_t> bIsInheritedInstance;
+		std::vector<uint32_t> packageFlags;
+		std::vector<int32_t> bNotAlwaysLoadedForEditorGame;
+		std::vector<int32_t> bIsAsset;
+		std::vector<int32_t> bGeneratePublicHash;
+		std::vector<int32_t> firstExportDependency;
+		std::vector<int32_t> serializationBeforeSerializationDependencies;
+		std::vector<int32_t> createBeforeSerializationDependencies;
+		std::vector<int32_t> serializationBeforeCreateDependencies;
+		std::vector<int32_t> createBeforeCreateDependencies;
+		std::vector<int64_t> scriptSerializationStartOffset;
+		std::vector<int64_t> scriptSerializationEndOffset;
+
+		size_t size() const { return classIndex.size(); }
+
+		void resize(size_t count) {
+			classIndex.assign(count, 0);
+			superIndex.assign(count, 0);
+			templateIndex.assign(count, 0);
+			outerIndex.assign(count, 0);
+			objectNameIndex.assign(count, 0);
+			objectNameNumber.assign(count, 0);
+			objectFlags.assign(count, 0);
+			serialSize.assign(count, 0);
+			serialOffset.assign(count, 0);
+			bForcedExport.assign(count, 0);
+			bNotForClient.assign(count, 0);
+			bNotForServer.assign(count, 0);
+			packageGuid.assign(count, "");
+			bIsInheritedInstance.assign(count, 0);
+			packageFlags.assign(count, 0);
+			bNotAlwaysLoadedForEditorGame.assign(count, 0);
+			bIsAsset.assign(count, 0);
+			bGeneratePublicHash.assign(count, 0);
+			firstExportDependency.assign(count, 0);
+			serializationBeforeSerializationDependencies.assign(count, 0);
+			createBeforeSerializationDependencies.assign(count, 0);
+			serializationBeforeCreateDependencies.assign(count, 0);
+			createBeforeCreateDependencies.assign(count, 0);
+			scriptSerializationStartOffset.assign(count, 0);
+			scriptSerializationEndOffset.assign(count, 0);
+		}
 	};
 
 	struct Name {
@@ -219,6 +447,47 @@ struct UassetData {
 		uint16_t CasePreservingHash;
 	};
 
+	// Name table lookup by string in O(1): open addressing (linear probing) keyed by the
+	// NonCasePreservingHash each name was saved with, so building it hashes no strings. Slots
+	// keep both hashes and strings are only compared when they match. Tables whose stored
+	// hashes fail a spot check (e.g. written as zeros) are keyed by recomputed hashes, and so
+	// are names with non-ASCII bytes: UE hashed their wide characters, which lookups of the
+	// decoded string cannot reproduce. An ASCII name whose own stored hash is corrupt is not
+	// found (ParseOptions::verifyNameHashes rejects such tables). The names are passed in
+	// rather than referenced, as data moves them around.
+	struct NameIndex {
+		void build(const std::vector<Name>& names);
+		void clear();
+		size_t size() const { return count; }
+		// Lowest index of a name equal to text, or -1
+		int32_t find(const std::vector<Name>& names, const std::string& text) const;
+		// Same with FName comparison rules: ASCII letters match regardless of case
+		int32_t findIgnoreCase(const std::vector<Name>& names, const std::string& text) const;
+
+		// Recomputes both hashes of every name and lists the ones that differ from the stored
+		// hashes. Names with non-ASCII bytes are skipped: UE hashes their wide characters,
+		// which the decoded string no longer holds.
+		struct HashCheck {
+			size_t checked = 0;
+			size_t skipped = 0;
+			std::vector<uint32_t> mismatches;
+		};
+		static HashCheck verifyHashes(const std::vector<Name>& names);
+
+	private:
+		struct Slot {
+			uint32_t name;   // index + 1; 0 marks an empty slot
+			uint16_t hash;
+			uint16_t caseHash;
+		};
+		std::vector<Slot> slots;
+		size_t count = 0;
+		uint32_t shift = 32;
+		uint32_t home(uint16_t hash) const { return static_cast<uint32_t>(hash * 2654435761u) >> shift; }
+		template <typename Match>
+		int32_t probe(const std::vector<Name>& names, uint16_t hash, Match match) const;
+	};
+
 	struct GatherableTextData {
 		std::string NamespaceName;
 		struct SourceDataStruct {
@@ -246,8 +515,107 @@ struct UassetData {
 	};
 
 	std::vector<Name> names;
+	NameIndex nameIndex;
 	std::vector<Import> imports;
+	// Import table as parallel arrays of name indices (entry i is import -(i + 1))
+	struct ImportMap {
+		std::vector<int32_t> classPackageIndex;
+		std::vector<int32_t> classNameIndex;
+		std::vector<int32_t> outerIndex;
+		std::vector<int32_t> objectNameIndex;
+		std::vector<int32_t> packageNameIndex;
+		std::vector<int32_t> bImportOptional;
+
+		size_t size() const { return objectNameIndex.size(); }
+
+		void resize(size_t count) {
+			classPackageIndex.assign(count, 0);
+			classNameIndex.assign(count, 0);
+			outerIndex.assign(count, 0);
+			objectNameIndex.assign(count, 0);
+			packageNameIndex.assign(count, 0);
+			bImportOptional.assign(count, 0);
+		}
+	};
+
+	// Imports and exports resolved once after the tables are read. Package indices map
+	// to objects (negative to imports, positive to exports) with their class and full
+	// path (/Game/.../Package.Outer.Object) cached; paths are hash-indexed.
+	struct ObjectGraph {
+		struct Object {
+			int32_t packageIndex;
+			int32_t outerIndex;
+			int32_t classIndex;
+			std::string objectName;
+			std::string className;
+			std::string fullPath;
+		};
+
+		// Longest fullPath kept (UE's NAME_SIZE). Objects whose path would be longer, and
+		// everything inside them, get an empty fullPath and are left out of pathIndex.
+		static constexpr size_t MaxPathLength = 1024;
+
+		std::string packagePath;
+		std::vector<Object> imports;
+		std::vector<Object> exports;
+		// Open addressing (linear probing) over the paths, like NameIndex; packageIndex 0 marks
+		// an empty slot. A flat table keeps its storage between builds, a node map does not.
+		struct PathSlot {
+			int32_t packageIndex;
+			uint32_t hash;
+		};
+		std::vector<PathSlot> pathIndex;
+
+		void build(const UassetData& data);
+		void clear();
+		const Object* find(int32_t packageIndex) const;
+		const Object* findByPath(const std::string& path) const;
+		const std::string& fullPath(int32_t packageIndex) const;
+		const std::string& className(int32_t packageIndex) const;
+
+	private:
+		std::vector<Object> spare;   // objects of an earlier package, reused by build()
+		void resolvePaths();
+	};
+
+	// Soft reference sections of the summary. They are not read by parse(); the
+	// Uasset accessors decode them on first use (see Uasset::softObjectPaths()).
+	struct SoftObjectPath {
+		std::string packageName;
+		std::string assetName;
+		std::string subPathString;
+	};
+
+	struct SearchableNamesEntry {
+		int32_t packageIndex;
+		std::vector<std::string> names;
+	};
+
+	enum LazySection : uint32_t {
+		SectionSoftObjectPaths = 1 << 0,
+		SectionSoftPackageReferences = 1 << 1,
+		SectionSearchableNames = 1 << 2
+	};
+
+	// Hashes of the regions reparse() compares: names (NameOffset up to the import table),
+	// the import table and each export body. Recorded when ParseOptions::sectionChecksums is set.
+	struct SectionChecksums {
+		bool valid = false;
+		uint64_t names = 0;
+		uint64_t imports = 0;
+		std::vector<uint64_t> exports;
+	};
+
 	std::vector<Export> exports;
+	ExportMap exportMap;
+	ImportMap importMap;
+	ObjectGraph objectGraph;
+	std::vector<SoftObjectPath> softObjectPaths;
+	std::vector<std::string> softPackageReferences;
+	std::vector<SearchableNamesEntry> searchableNames;
+	std::vector<int32_t> preloadDependencies;
+	uint32_t decodedSections = 0;
+	SectionChecksums sectionChecksums;
 	std::vector<GatherableTextData> gatherableTextData;
 	std::vector<ThumbnailIndex> thumbnailsIndex;
 	std::vector<Thumbnail> thumbnails;
@@ -263,6 +631,53 @@ private:
 	std::string msg_;
 };
 
+// Byte layout of one FObjectExport record. Which fields are present depends only on
+// the package file versions, so the layout is computed once per package.
+struct ExportRecordLayout {
+	bool hasTemplateIndex;
+	bool hasInt64SerialFields;
+	bool hasPackageGuid;
+	bool hasIsInheritedInstance;
+	bool hasNotAlwaysLoadedForEditorGame;
+	bool hasIsAsset;
+	bool hasGeneratePublicHash;
+	bool hasDependencies;
+	bool hasScriptSerializationOffsets;
+	size_t serialFieldsOffset;  // position of SerialSize within a record; SerialOffset follows
+	size_t recordSize;
+};
+
+ExportRecordLayout computeExportRecordLayout(const UassetData::Header& header) {
+	ExportRecordLayout layout;
+	layout.hasTemplateIndex = header.FileVersionUE4 >= 0x01FC; // VER_UE4_TEMPLATEINDEX_IN_COOKED_EXPORTS
+	layout.hasInt64SerialFields = header.FileVersionUE4 >= 0x01FF; // VER_UE4_64BIT_EXPORTMAP_SERIALSIZES
+	layout.hasPackageGuid = header.FileVersionUE5 < 0x03ED; // VER_UE5_REMOVE_OBJECT_EXPORT_PACKAGE_GUID
+	layout.hasIsInheritedInstance = header.FileVersionUE5 >= 0x03EE; // VER_UE5_TRACK_OBJECT_EXPORT_IS_INHERITED
+	layout.hasNotAlwaysLoadedForEditorGame = header.FileVersionUE4 >= 0x016D; // VER_UE4_LOAD_FOR_EDITOR_GAME
+	layout.hasIsAsset = header.FileVersionUE4 >= 0x01E5; // VER_UE4_COOKED_ASSETS_IN_EDITOR_SUPPORT
+	layout.hasGeneratePublicHash = header.FileVersionUE5 >= 0x03EB; // VER_UE5_OPTIONAL_RESOURCES
+	layout.hasDependencies = header.FileVersionUE4 >= 0x01FB; // VER_UE4_PRELOAD_DEPENDENCIES_IN_COOKED_EXPORTS
+	layout.hasScriptSerializationOffsets = header.FileVersionUE5 >= 0x03F2; // VER_UE5_SCRIPT_SERIALIZATION_OFFSET
+
+	size_t serialFieldSize = layout.hasInt64SerialFields ? sizeof(int64_t) : sizeof(int32_t);
+	layout.serialFieldsOffset = (layout.hasTemplateIndex ? 7 : 6) * sizeof(int32_t);
+	layout.recordSize = 3 * sizeof(int32_t);            // ClassIndex, SuperIndex, OuterIndex
+	layout.recordSize += 2 * sizeof(int32_t);           // ObjectName (index, number)
+	layout.recordSize += sizeof(uint32_t);              // ObjectFlags
+	layout.recordSize += 2 * serialFieldSize;           // SerialSize, SerialOffset
+	layout.recordSize += 3 * sizeof(int32_t);           // bForcedExport, bNotForClient, bNotForServer
+	layout.recordSize += sizeof(uint32_t);              // PackageFlags
+	if (layout.hasTemplateIndex) layout.recordSize += sizeof(int32_t);
+	if (layout.hasPackageGuid) layout.recordSize += 16;
+	if (layout.hasIsInheritedInstance) layout.recordSize += sizeof(int32_t);
+	if (layout.hasNotAlwaysLoadedForEditorGame) layout.recordSize += sizeof(int32_t);
+	if (layout.hasIsAsset) layout.recordSize += sizeof(int32_t);
+	if (layout.hasGeneratePublicHash) layout.recordSize += sizeof(int32_t);
+	if (layout.hasDependencies) layout.recordSize += 5 * sizeof(int32_t);
+	if (layout.hasScriptSerializationOffsets) layout.recordSize += 2 * sizeof(int64_t);
+	return layout;
+}
+
 // Function to convert a GUID to a string
 std::string guidToString(uint8_t guid[16]) {
 	std::ostringstream ss;
@@ -274,22 +689,355 @@ std::string guidToString(uint8_t guid[16]) {
 	return ss.str();
 }
 
+// Function to convert a GUID as stored on disk (four little-endian 32-bit words) to a string.
+// Formatted by hand rather than through a stream: this runs for every GUID property.
+void guidBytesToString(const uint8_t* guid, std::string& out) {
+	// Output bytes in word order, e.g. 27 C4 29 09 - 46 2F - 46 F9 - 5F 7B - 3A 8B 18 35 6D 39
+	static const int order[16] = { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 };
+	static const char digits[] = "0123456789abcdef";
+	char text[36];
+	size_t length = 0;
+	for (int i = 0; i < 16; ++i) {
+		if (i == 4 || i == 6 || i == 8 || i == 10) {
+			text[length++] = '-';
+		}
+		text[length++] = digits[guid[order[i]] >> 4];
+		text[length++] = digits[guid[order[i]] & 0x0F];
+	}
+	out.assign(text, length);
+}
+
+std::string guidBytesToString(const uint8_t* guid) {
+	std::string text;
+	guidBytesToString(guid, text);
+	return text;
+}
+
+// Inverse of guidBytesToString; returns false unless text holds exactly 32 hex digits
+bool guidStringToBytes(const std::string& text, uint8_t* guid) {
+	static const int order[16] = { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 };
+	std::string digits;
+	for (char c : text) {
+		if (c != '-') {
+			digits.push_back(c);
+		}
+	}
+	if (digits.size() != 32 || digits.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) {
+		return false;
+	}
+	for (int i = 0; i < 16; ++i) {
+		guid[order[i]] = static_cast<uint8_t>(std::stoi(digits.substr(i * 2, 2), nullptr, 16));
+	}
+	return true;
+}
+
+// 64-bit hash of a byte range, mixed a word at a time so large export bodies hash at memory speed
+uint64_t hashBytes(const uint8_t* bytes, size_t size) {
+	const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+	uint64_t hash = size * multiplier;
+	size_t i = 0;
+	for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+		uint64_t word;
+		std::memcpy(&word, bytes + i, sizeof(word));
+		hash = (hash ^ word) * multiplier;
+		hash ^= hash >> 29;
+	}
+	uint64_t tail = 0;
+	std::memcpy(&tail, bytes + i, size - i);
+	hash = (hash ^ tail) * multiplier;
+	return hash ^ (hash >> 32);
+}
+
+// Cursor over a fixed-layout block (export record, tag header, ...) whose length
+// was bounds-checked once by Uasset::readSpan. Fields are then read without checks.
+class SpanReader {
+public:
+	SpanReader(const uint8_t* data, size_t size) : ptr_(data), end_(data + size) {}
+
+	template <typename T>
+	T read() {
+		T val;
+		std::memcpy(&val, ptr_, sizeof(val));
+		ptr_ += sizeof(val);
+		return val;
+	}
+
+	std::string readGuid() {
+		std::string guid = guidBytesToString(ptr_);
+		ptr_ += 16;
+		return guid;
+	}
+
+	void readGuid(std::string& out) {
+		guidBytesToString(ptr_, out);
+		ptr_ += 16;
+	}
+
+	void skip(size_t count) { ptr_ += count; }
+	size_t remaining() const { return static_cast<size_t>(end_ - ptr_); }
+
+private:
+	const uint8_t* ptr_;
+	const uint8_t* end_;
+};
+
 #define REFLECTABLE_CLASS  \
 public: \
     static const char* GetClassName() { return __FUNCTION__; }
 
 
 
+// Where a parse spends its time. Uasset fills one only when ParseOptions::profile is set;
+// otherwise each section and each tag costs a single untaken branch.
+struct ParseProfile {
+	enum Section {
+		Header, Names, GatherableText, Imports, ExportMap, ExportData, PreloadDependencies, ObjectGraph,
+		Thumbnails, AssetRegistry, SectionCount
+	};
+	struct SectionStats {
+		double ms = 0;
+		uint64_t bytes = 0;   // from where the section starts to where its reader stopped
+		uint64_t calls = 0;
+	};
+
+	uint64_t files = 0;
+	SectionStats sections[SectionCount];
+	std::unordered_map<std::string, uint64_t> handlerTags;   // tags claimed by a process* handler, by structure type
+	std::unordered_map<std::string, uint64_t> unknownTags;   // tags no handler claimed, by FName
+	uint64_t entityTags = 0;
+	uint64_t paddingTags = 0;
+	uint64_t allocations = 0;    // operator new calls made on the parsing thread
+	uint64_t allocatedBytes = 0;
+
+	// One timed span per section and per decoded export, kept only when recordSpans is set
+	struct Span {
+		Section section;
+		std::string name;
+		std::chrono::steady_clock::time_point begin;
+		std::chrono::steady_clock::time_point end;
+	};
+	bool recordSpans = false;
+	std::vector<Span> spans;   // not merged
+
+	static const char* sectionName(Section section) {
+		static const char* names[SectionCount] = {
+			"header", "names", "gatherableText", "imports", "exportMap", "exportData", "preloadDependencies", "objectGraph",
+			"thumbnails", "assetRegistry",
+		};
+		return names[section];
+	}
+
+	void merge(const ParseProfile& other) {
+		files += other.files;
+		for (int i = 0; i < SectionCount; ++i) {
+			sections[i].ms += other.sections[i].ms;
+			sections[i].bytes += other.sections[i].bytes;
+			sections[i].calls += other.sections[i].calls;
+		}
+		for (const auto& tag : other.handlerTags) {
+			handlerTags[tag.first] += tag.second;
+		}
+		for (const auto& tag : other.unknownTags) {
+			unknownTags[tag.first] += tag.second;
+		}
+		entityTags += other.entityTags;
+		paddingTags += other.paddingTags;
+		allocations += other.allocations;
+		allocatedBytes += other.allocatedBytes;
+	}
+
+	json toJson() const {
+		json result;
+		result["files"] = files;
+		double totalMs = 0;
+		for (int i = 0; i < SectionCount; ++i) {
+			const SectionStats& stats = sections[i];
+			result["sections"][sectionName(static_cast<Section>(i))] = {
+				{"ms", stats.ms}, {"bytes", stats.bytes}, {"calls", stats.calls},
+			};
+			totalMs += stats.ms;
+		}
+		result["totalMs"] = totalMs;
+		result["handlerTags"] = handlerTags;
+		result["unknownTags"] = unknownTags;
+		result["entityTags"] = entityTags;
+		result["paddingTags"] = paddingTags;
+		result["allocations"] = allocations;
+		result["allocatedBytes"] = allocatedBytes;
+		return result;
+	}
+};
+
+// The profile whose allocation counters operator new feeds, set by Uasset::parse
+thread_local ParseProfile* allocationProfile = nullptr;
+
+// Sanitizer builds used for fuzzing supply their own operator new
+#if defined(UEPARSER_FUZZ) && !defined(UEPARSER_NO_ALLOCATION_COUNTING)
+#define UEPARSER_NO_ALLOCATION_COUNTING
+#endif
+
+#ifndef UEPARSER_NO_ALLOCATION_COUNTING
+void* operator new(std::size_t size) {
+	if (allocationProfile != nullptr) {
+		++allocationProfile->allocations;
+		allocationProfile->allocatedBytes += size;
+	}
+	for (;;) {
+		if (void* memory = std::malloc(size > 0 ? size : 1)) {
+			return memory;
+		}
+		std::new_handler handler = std::get_new_handler();
+		if (handler == nullptr) {
+			throw std::bad_alloc();
+		}
+		handler();
+	}
+}
+
+// GCC flags free() on memory from operator new once these are inlined, though here it is correct
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+// Adds the time and bytes of one section to a profile; a null profile makes it a no-op
+class ProfileScope {
+public:
+	ProfileScope(ParseProfile* profile, ParseProfile::Section section, const size_t& cursor, size_t start, const std::string* label = nullptr)
+		: profile_(profile), section_(section), cursor_(cursor), start_(start), label_(label) {
+		if (profile_ != nullptr) {
+			begin_ = std::chrono::steady_clock::now();
+		}
+	}
+	~ProfileScope() {
+		if (profile_ != nullptr) {
+			auto end = std::chrono::steady_clock::now();
+			ParseProfile::SectionStats& stats = profile_->sections[section_];
+			stats.ms += std::chrono::duration<double, std::milli>(end - begin_).count();
+			stats.bytes += cursor_ > start_ ? cursor_ - start_ : 0;
+			++stats.calls;
+			if (profile_->recordSpans) {
+				profile_->spans.push_back({ section_, label_ != nullptr ? *label_ : ParseProfile::sectionName(section_), begin_, end });
+			}
+		}
+	}
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	ParseProfile* profile_;
+	ParseProfile::Section section_;
+	const size_t& cursor_;
+	size_t start_;
+	const std::string* label_;
+	std::chrono::steady_clock::time_point begin_;
+};
+
+// Controls which sections Uasset::parse decodes
+struct ParseOptions {
+	bool verbose = true;         // print header fields while reading them
+	bool readExportData = true;  // copy and decode export bodies (everything past TotalHeaderSize)
+	bool readThumbnails = true;
+	bool readAssetRegistry = false;
+	bool sectionChecksums = false;   // hash sections so a later reparse() can skip unchanged ones
+	bool profile = false;            // fill Uasset::profile with per-section timings and tag counts
+	bool traceSpans = false;         // with profile, also keep a timed span per section and export
+	bool coverage = false;           // record which byte ranges of each export body were decoded
+	bool verifyNameHashes = false;   // recompute the name table hashes and reject the package if one differs
+
+	// Work budgets that bound a parse of malformed input in time and memory; 0 turns one off
+	size_t maxTagsPerExport = 1 << 20;   // readExportData loop iterations for one export
+	size_t maxAllocationRatio = 16;      // largest buffer a declared size may request, in multiples of the input
+	size_t maxExportReadRatio = 16;      // bytes readExportData may decode for one export, in multiples of its size (at least 4 KB)
+};
+
 class Uasset {
 public:
 	UassetData data;
+	ParseOptions options;
 	REFLECTABLE_CLASS
 		bool parse(const std::vector<uint8_t>& bytes);
+	bool parseHeader(const std::vector<uint8_t>& bytes);
+	bool parseNames(const std::vector<uint8_t>& bytes);
+	// Empties data for the next parse without giving its memory back: tables are cleared in
+	// place and names, imports and exports are kept in spare pools for the readers to refill.
+	// A worker that keeps one Uasset across files allocates little once it has seen a package
+	// as large as the current one.
+	void reset();
+	// Parses a new version of the package last parsed into data, keeping the names, imports
+	// and decoded exports whose bytes did not change. Falls back to parse() without checksums.
+	bool reparse(const std::vector<uint8_t>& bytes);
+	struct ReparseStats {
+		bool namesReused = false;
+		bool namesAppended = false;   // the name table only grew, so earlier name indices still hold
+		bool importsReused = false;
+		size_t exportsReused = 0;
+		size_t exportsDecoded = 0;
+	} lastReparse;
+	ParseProfile profile;   // the last parse's, when options.profile is set
 	json toJson() const;
+	json headerJson() const;
+	json exportJson(const UassetData::Export& exportData) const;
+
+	// Lazily decoded summary sections. They read from the buffer last given to parse(),
+	// which must still be alive; no export body is touched.
+	const std::vector<UassetData::SoftObjectPath>& softObjectPaths();
+	const std::vector<std::string>& softPackageReferences();
+	const std::vector<UassetData::SearchableNamesEntry>& searchableNames();
+	bool loadThumbnail(size_t index);
+	// Forgets the buffer given to parse(). Call it before freeing that buffer when the Uasset
+	// lives on; sections not decoded by then stay empty and loadThumbnail() returns false.
+	void release() { bytesPtr = nullptr; }
 private:
+	friend class ParserBenchmark;   // times the private readers directly
+
 	size_t currentIdx = 0;
 	const std::vector<uint8_t>* bytesPtr = nullptr;
 
+	// Elements of earlier parses, filled by reset() and drawn from by the readers
+	struct SparePool {
+		std::vector<UassetData::Name> names;
+		std::vector<UassetData::Import> imports;
+		std::vector<UassetData::Export> exports;
+		std::vector<UassetData::Export::Property> properties;
+	} spare;
+	template <typename T>
+	static T reuse(std::vector<T>& pool) {
+		if (pool.empty()) {
+			return T();
+		}
+		T element = std::move(pool.back());
+		pool.pop_back();
+		return element;
+	}
+
+	// Read a fixed-size value into the property and record where it lies, so PackagePatcher
+	// can rewrite it in place
+	void readIntValue(UassetData::Export::Property& property);
+	void readGuidValue(UassetData::Export::Property& property);
+	void addProperty(UassetData::Export& exportData, const UassetData::Export::Property& property);
+	UassetData::Export::Property& addProperty(UassetData::Export& exportData);
+
+	std::ostream& log();
+	ParseProfile* profiling() {
+		return options.profile ? &profile : nullptr;
+	}
+
+	// Bounds check for the read primitives; a bogus offset from the file can leave the cursor past the end
+	bool canRead(uint64_t count) const {
+		return currentIdx <= bytesPtr->size() && count <= bytesPtr->size() - currentIdx;
+	}
 	uint16_t readUint16();
 	int32_t readInt32();
 	uint32_t readUint32();
@@ -297,8 +1045,14 @@ private:
 	int64_t readInt64Export();
 	//    uint64_t readUint64();
 	std::string readFString();
+	void readFString(std::string& out);
 	std::string readGuid();
+	void readGuid(std::string& out);
+	std::string readEngineVersion();
+	SpanReader readSpan(size_t size);
 	std::vector<uint8_t> readCountBytes(int64_t count);
+	void copyBytes(std::vector<uint8_t>& out, int64_t count);
+	void checkAllocation(int64_t count, size_t elementSize, const char* what) const;
 	float readFloat();
 	bool readBool();
 	uint32_t lowerBytes(uint64_t value);
@@ -309,8 +1063,18 @@ private:
 	void readNames();
 	bool readGatherableTextData();
 	void readImports();
+	void readSoftObjectPaths();
+	void readSoftPackageReferences();
+	void readSearchableNames();
+	bool decodeSection(UassetData::LazySection section, void (Uasset::* reader)());
+	void readExportMap();
 	void readExports();
+	void fillExportRecord(UassetData::Export& exportData, size_t i);
+	UassetData::SectionChecksums computeSectionChecksums() const;
+	void readPreloadDependencies();
 	void readExportData(UassetData::Export& exportData);
+	enum class TagOutcome { Padding, Entity, Handler, Unclaimed };
+	void noteTag(UassetData::Export& exportData, size_t tagStart, size_t firstProperty, TagOutcome outcome, const char* name);
 	std::string determineStructureType(const std::string& objectClass);
 	void processParentClass(UassetData::Export& exportData, size_t& exportDataIdx);
 	void processAdvancedPinDisplay(UassetData::Export& exportData, size_t& exportDataIdx);
@@ -351,7 +1115,7 @@ private:
 	void processNone(UassetData::Export& exportData, size_t& exportDataIdx);
 	void processInputChord(UassetData::Export& exportData, size_t& exportDataIdx);
 	void processKey(UassetData::Export& exportData, size_t& exportDataIdx);
-	void detectPaddingAfterNone();
+	void detectPaddingAfterNone(size_t end);
 	void processobject(UassetData::Export& exportData, size_t& exportDataIdx);
 	void processInputKeyDelegateBindings(UassetData::Export& exportData, size_t& exportDataIdx);
 	void processDelegateReference(UassetData::Export& exportData, size_t& exportDataIdx);
@@ -411,11 +1175,12 @@ private:
 	uint8_t readByte();
 
 	void readThumbnails();
-	std::string resolveFName(int64_t idx);
+	const std::string& resolveFName(int64_t idx);
+	void assignFName(std::string& out, int32_t index, int32_t number);
 };
 
 uint8_t Uasset::readByte() {
-	if (currentIdx + sizeof(uint8_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(uint8_t))) {
 		throw ParseException("Out of bounds read (byte)");
 	}
 	uint8_t val = (*bytesPtr)[currentIdx];
@@ -423,26 +1188,147 @@ uint8_t Uasset::readByte() {
 	return val;
 }
 
-bool Uasset::parse(const std::vector<uint8_t>& bytes) {
-	const char* t = Uasset::GetClassName();
+// Header-field output goes through log() so batch runs can silence it
+std::ostream& Uasset::log() {
+	static std::ostream nullStream(nullptr);
+	return options.verbose ? std::cout : nullStream;
+}
+
+// Reads only the package summary; used to learn TotalHeaderSize before loading the rest
+bool Uasset::parseHeader(const std::vector<uint8_t>& bytes) {
+	reset();
 	currentIdx = 0;
 	bytesPtr = &bytes;
 
 	try {
-		if (!readHeader()) {
-			throw ParseException("Failed to read header");
-		}
+		return readHeader();
+	}
+	catch (const ParseException&) {
+		return false;
+	}
+}
+
+void Uasset::reset() {
+	// Pooled in reverse, so reuse() hands elements back in their old order and a package parsed
+	// again gets each string back with the capacity it needed last time
+	for (auto name = data.names.rbegin(); name != data.names.rend(); ++name) {
+		spare.names.push_back(std::move(*name));
+	}
+	for (auto importA = data.imports.rbegin(); importA != data.imports.rend(); ++importA) {
+		spare.imports.push_back(std::move(*importA));
+	}
+	for (auto exportData = data.exports.rbegin(); exportData != data.exports.rend(); ++exportData) {
+		for (auto property = exportData->properties.rbegin(); property != exportData->properties.rend(); ++property) {
+			spare.properties.push_back(std::move(*property));
+		}
+		exportData->clear();
+		spare.exports.push_back(std::move(*exportData));
+	}
+
+	// Everything else starts over from a fresh UassetData, apart from the containers whose
+	// storage is worth keeping
+	std::vector<UassetData::Name> names = std::move(data.names);
+	UassetData::NameIndex nameIndex = std::move(data.nameIndex);
+	std::vector<UassetData::Import> imports = std::move(data.imports);
+	std::vector<UassetData::Export> exports = std::move(data.exports);
+	UassetData::ExportMap exportMap = std::move(data.exportMap);
+	UassetData::ImportMap importMap = std::move(data.importMap);
+	UassetData::ObjectGraph objectGraph = std::move(data.objectGraph);
+	std::vector<int32_t> preloadDependencies = std::move(data.preloadDependencies);
+	data = UassetData();
+
+	names.clear();
+	nameIndex.clear();
+	imports.clear();
+	exports.clear();
+	exportMap.resize(0);
+	importMap.resize(0);
+	objectGraph.clear();
+	preloadDependencies.clear();
+	data.names = std::move(names);
+	data.nameIndex = std::move(nameIndex);
+	data.imports = std::move(imports);
+	data.exports = std::move(exports);
+	data.exportMap = std::move(exportMap);
+	data.importMap = std::move(importMap);
+	data.objectGraph = std::move(objectGraph);
+	data.preloadDependencies = std::move(preloadDependencies);
+}
 
+// Reads the summary and the name table only
+bool Uasset::parseNames(const std::vector<uint8_t>& bytes) {
+	if (!parseHeader(bytes)) {
+		return false;
+	}
+	try {
 		readNames();
+		return true;
+	}
+	catch (const ParseException&) {
+		return false;
+	}
+}
 
-		if (!readGatherableTextData()) {
-			throw ParseException("Failed to read gatherable text data");
-		}
+bool Uasset::parse(const std::vector<uint8_t>& bytes) {
+	const char* t = Uasset::GetClassName();
+	reset();
+	currentIdx = 0;
+	bytesPtr = &bytes;
+	ParseProfile* prof = profiling();
+	if (prof != nullptr) {
+		profile = ParseProfile();
+		profile.files = 1;
+		profile.recordSpans = options.traceSpans;
+	}
+	ParseProfile* outerAllocationProfile = allocationProfile;
+	allocationProfile = prof;
+	struct RestoreAllocationProfile {
+		ParseProfile* previous;
+		~RestoreAllocationProfile() { allocationProfile = previous; }
+	} restoreAllocationProfile{ outerAllocationProfile };
 
-		readImports();
+	try {
+		{
+			ProfileScope scope(prof, ParseProfile::Header, currentIdx, 0);
+			if (!readHeader()) {
+				throw ParseException("Failed to read header");
+			}
+		}
+		{
+			ProfileScope scope(prof, ParseProfile::Names, currentIdx, data.header.NameOffset);
+			readNames();
+		}
+		{
+			ProfileScope scope(prof, ParseProfile::GatherableText, currentIdx, data.header.GatherableTextDataOffset);
+			if (!readGatherableTextData()) {
+				throw ParseException("Failed to read gatherable text data");
+			}
+		}
+		{
+			ProfileScope scope(prof, ParseProfile::Imports, currentIdx, data.header.ImportOffset);
+			readImports();
+		}
 		readExports();
-		readThumbnails();
-		//       readAssetRegistryData();
+		{
+			size_t preloadStart = data.header.PreloadDependencyCount > 0 ? data.header.PreloadDependencyOffset : currentIdx;
+			ProfileScope scope(prof, ParseProfile::PreloadDependencies, currentIdx, preloadStart);
+			readPreloadDependencies();
+		}
+		{
+			ProfileScope scope(prof, ParseProfile::ObjectGraph, currentIdx, currentIdx);
+			data.objectGraph.build(data);
+		}
+		if (options.readThumbnails) {
+			ProfileScope scope(prof, ParseProfile::Thumbnails, currentIdx, data.header.ThumbnailTableOffset);
+			readThumbnails();
+		}
+		if (options.readAssetRegistry) {
+			ProfileScope scope(prof, ParseProfile::AssetRegistry, currentIdx, data.header.AssetRegistryDataOffset);
+			readAssetRegistryData();
+		}
+		if (options.sectionChecksums) {
+			data.sectionChecksums = computeSectionChecksums();
+		}
 		return true;
 	}
 	catch (const ParseException& e) {
@@ -453,100 +1339,114 @@ bool Uasset::parse(const std::vector<uint8_t>& bytes) {
 
 bool Uasset::readHeader() {
 	data.header.EPackageFileTag = readUint32();
-	std::cout << "EPackageFileTag: " << data.header.EPackageFileTag << std::endl;
+	log() << "EPackageFileTag: " << data.header.EPackageFileTag << std::endl;
 
 	data.header.LegacyFileVersion = readInt32();
-	std::cout << "LegacyFileVersion: " << data.header.LegacyFileVersion << std::endl;
+	log() << "LegacyFileVersion: " << data.header.LegacyFileVersion << std::endl;
 
 	data.header.LegacyUE3Version = readInt32();
-	std::cout << "LegacyUE3Version: " << data.header.LegacyUE3Version << std::endl;
+	log() << "LegacyUE3Version: " << data.header.LegacyUE3Version << std::endl;
 
 	data.header.FileVersionUE4 = readInt32();
-	std::cout << "FileVersionUE4: " << data.header.FileVersionUE4 << std::endl;
+	log() << "FileVersionUE4: " << data.header.FileVersionUE4 << std::endl;
 
 	if (data.header.LegacyFileVersion <= -8) {
 		data.header.FileVersionUE5 = readInt32();
-		std::cout << "FileVersionUE5: " << data.header.FileVersionUE5 << std::endl;
+		log() << "FileVersionUE5: " << data.header.FileVersionUE5 << std::endl;
+	}
+	else {
+		data.header.FileVersionUE5 = 0;
 	}
 
 	data.header.FileVersionLicenseeUE4 = readInt32();
-	std::cout << "FileVersionLicenseeUE4: " << data.header.FileVersionLicenseeUE4 << std::endl;
+	log() << "FileVersionLicenseeUE4: " << data.header.FileVersionLicenseeUE4 << std::endl;
 
 	int32_t customVersionsCount = readInt32();
-	std::cout << "CustomVersions Count: " << customVersionsCount << std::endl;
+	log() << "CustomVersions Count: " << customVersionsCount << std::endl;
 	for (int32_t i = 0; i < customVersionsCount; ++i) {
 		std::string key = readGuid();
 		int32_t version = readInt32();
 		data.header.CustomVersions.push_back({ key, version });
-		std::cout << "CustomVersion[" << i << "]: " << key << " - " << version << std::endl;
+		log() << "CustomVersion[" << i << "]: " << key << " - " << version << std::endl;
 	}
 
+	data.summaryLayout.TotalHeaderSize = currentIdx;
 	data.header.TotalHeaderSize = readInt32();
-	std::cout << "TotalHeaderSize: " << data.header.TotalHeaderSize << std::endl;
+	log() << "TotalHeaderSize: " << data.header.TotalHeaderSize << std::endl;
 
 	data.header.FolderName = readFString();
-	std::cout << "FolderName: " << data.header.FolderName << std::endl;
+	log() << "FolderName: " << data.header.FolderName << std::endl;
 
 	data.header.PackageFlags = readUint32();
-	std::cout << "PackageFlags: " << data.header.PackageFlags << std::endl;
+	log() << "PackageFlags: " << data.header.PackageFlags << std::endl;
 
+	data.summaryLayout.NameCount = currentIdx;
 	data.header.NameCount = readInt32();
-	std::cout << "NameCount: " << data.header.NameCount << std::endl;
+	log() << "NameCount: " << data.header.NameCount << std::endl;
 
+	data.summaryLayout.NameOffset = currentIdx;
 	data.header.NameOffset = readInt32();
-	std::cout << "NameOffset: " << data.header.NameOffset << std::endl;
+	log() << "NameOffset: " << data.header.NameOffset << std::endl;
 
 	if (data.header.FileVersionUE5 >= 0x0151) { // VER_UE5_ADD_SOFTOBJECTPATH_LIST
 		data.header.SoftObjectPathsCount = readUint32();
-		std::cout << "SoftObjectPathsCount: " << data.header.SoftObjectPathsCount << std::endl;
+		log() << "SoftObjectPathsCount: " << data.header.SoftObjectPathsCount << std::endl;
+		data.summaryLayout.SoftObjectPathsOffset = currentIdx;
 		data.header.SoftObjectPathsOffset = readUint32();
-		std::cout << "SoftObjectPathsOffset: " << data.header.SoftObjectPathsOffset << std::endl;
+		log() << "SoftObjectPathsOffset: " << data.header.SoftObjectPathsOffset << std::endl;
 	}
 
 	data.header.LocalizationId = readFString();
-	std::cout << "LocalizationId: " << data.header.LocalizationId << std::endl;
+	log() << "LocalizationId: " << data.header.LocalizationId << std::endl;
 
 	data.header.GatherableTextDataCount = readInt32();
-	std::cout << "GatherableTextDataCount: " << data.header.GatherableTextDataCount << std::endl;
+	log() << "GatherableTextDataCount: " << data.header.GatherableTextDataCount << std::endl;
+	data.summaryLayout.GatherableTextDataOffset = currentIdx;
 	data.header.GatherableTextDataOffset = readInt32();
-	std::cout << "GatherableTextDataOffset: " << data.header.GatherableTextDataOffset << std::endl;
+	log() << "GatherableTextDataOffset: " << data.header.GatherableTextDataOffset << std::endl;
 
 	data.header.ExportCount = readInt32();
-	std::cout << "ExportCount: " << data.header.ExportCount << std::endl;
+	log() << "ExportCount: " << data.header.ExportCount << std::endl;
+	data.summaryLayout.ExportOffset = currentIdx;
 	data.header.ExportOffset = readInt32();
-	std::cout << "ExportOffset: " << data.header.ExportOffset << std::endl;
+	log() << "ExportOffset: " << data.header.ExportOffset << std::endl;
 	data.header.ImportCount = readInt32();
-	std::cout << "ImportCount: " << data.header.ImportCount << std::endl;
+	log() << "ImportCount: " << data.header.ImportCount << std::endl;
+	data.summaryLayout.ImportOffset = currentIdx;
 	data.header.ImportOffset = readInt32();
-	std::cout << "ImportOffset: " << data.header.ImportOffset << std::endl;
+	log() << "ImportOffset: " << data.header.ImportOffset << std::endl;
+	data.summaryLayout.DependsOffset = currentIdx;
 	data.header.DependsOffset = readInt32();
-	std::cout << "DependsOffset: " << data.header.DependsOffset << std::endl;
+	log() << "DependsOffset: " << data.header.DependsOffset << std::endl;
 
 	if (data.header.FileVersionUE4 >= 0x0154) { // VER_UE4_ADD_STRING_ASSET_REFERENCES_MAP
 		data.header.SoftPackageReferencesCount = readInt32();
-		std::cout << "SoftPackageReferencesCount: " << data.header.SoftPackageReferencesCount << std::endl;
+		log() << "SoftPackageReferencesCount: " << data.header.SoftPackageReferencesCount << std::endl;
+		data.summaryLayout.SoftPackageReferencesOffset = currentIdx;
 		data.header.SoftPackageReferencesOffset = readInt32();
-		std::cout << "SoftPackageReferencesOffset: " << data.header.SoftPackageReferencesOffset << std::endl;
+		log() << "SoftPackageReferencesOffset: " << data.header.SoftPackageReferencesOffset << std::endl;
 	}
 
 	if (data.header.FileVersionUE4 >= 0x0163) { // VER_UE4_ADDED_SEARCHABLE_NAMES
+		data.summaryLayout.SearchableNamesOffset = currentIdx;
 		data.header.SearchableNamesOffset = readInt32();
-		std::cout << "SearchableNamesOffset: " << data.header.SearchableNamesOffset << std::endl;
+		log() << "SearchableNamesOffset: " << data.header.SearchableNamesOffset << std::endl;
 	}
 
+	data.summaryLayout.ThumbnailTableOffset = currentIdx;
 	data.header.ThumbnailTableOffset = readInt32();
-	std::cout << "ThumbnailTableOffset: " << data.header.ThumbnailTableOffset << std::endl;
+	log() << "ThumbnailTableOffset: " << data.header.ThumbnailTableOffset << std::endl;
 	data.header.Guid = readGuid();
-	std::cout << "Guid: " << data.header.Guid << std::endl;
+	log() << "Guid: " << data.header.Guid << std::endl;
 
 	if (data.header.FileVersionUE4 >= 0x0166) { // VER_UE4_ADDED_PACKAGE_OWNER
 		data.header.PersistentGuid = readGuid();
-		std::cout << "PersistentGuid: " << data.header.PersistentGuid << std::endl;
+		log() << "PersistentGuid: " << data.header.PersistentGuid << std::endl;
 	}
 
 	if (data.header.FileVersionUE4 >= 0x0166 && data.header.FileVersionUE4 < 0x0183) { // VER_UE4_NON_OUTER_PACKAGE_IMPORT
 		data.header.OwnerPersistentGuid = readGuid();
-		std::cout << "OwnerPersistentGuid: " << data.header.OwnerPersistentGuid << std::endl;
+		log() << "OwnerPersistentGuid: " << data.header.OwnerPersistentGuid << std::endl;
 	}
 
 	int32_t generationsCount = readInt32();
@@ -558,22 +1458,14 @@ bool Uasset::readHeader() {
 	}
 
 	if (data.header.FileVersionUE4 >= 0x0171) { // VER_UE4_ENGINE_VERSION_OBJECT
-		data.header.SavedByEngineVersion = std::to_string(readUint16()) + "." +
-			std::to_string(readUint16()) + "." +
-			std::to_string(readUint16()) + "-" +
-			std::to_string(readUint32()) + "+" +
-			readFString();
+		data.header.SavedByEngineVersion = readEngineVersion();
 	}
 	else {
 		data.header.EngineChangelist = readInt32();
 	}
 
 	if (data.header.FileVersionUE4 >= 0x0175) { // VER_UE4_PACKAGE_SUMMARY_HAS_COMPATIBLE_ENGINE_VERSION
-		data.header.CompatibleWithEngineVersion = std::to_string(readUint16()) + "." +
-			std::to_string(readUint16()) + "." +
-			std::to_string(readUint16()) + "-" +
-			std::to_string(readUint32()) + "+" +
-			readFString();
+		data.header.CompatibleWithEngineVersion = readEngineVersion();
 	}
 	else {
 		data.header.CompatibleWithEngineVersion = data.header.SavedByEngineVersion;
@@ -596,10 +1488,13 @@ bool Uasset::readHeader() {
 		data.header.NumTextureAllocations = readInt32();
 	}
 
+	data.summaryLayout.AssetRegistryDataOffset = currentIdx;
 	data.header.AssetRegistryDataOffset = readInt32();
+	data.summaryLayout.BulkDataStartOffset = currentIdx;
 	data.header.BulkDataStartOffset = readInt64();
 
 	if (data.header.FileVersionUE4 >= 0x0183) { // VER_UE4_WORLD_LEVEL_INFO
+		data.summaryLayout.WorldTileInfoDataOffset = currentIdx;
 		data.header.WorldTileInfoDataOffset = readInt32();
 	}
 
@@ -618,6 +1513,7 @@ bool Uasset::readHeader() {
 
 	if (data.header.FileVersionUE4 >= 0x0194) { // VER_UE4_PRELOAD_DEPENDENCIES_IN_COOKED_EXPORTS
 		data.header.PreloadDependencyCount = readInt32();
+		data.summaryLayout.PreloadDependencyOffset = currentIdx;
 		data.header.PreloadDependencyOffset = readInt32();
 	}
 	else {
@@ -630,6 +1526,7 @@ bool Uasset::readHeader() {
 	}
 
 	if (data.header.FileVersionUE5 >= 0x0197) { // VER_UE5_PAYLOAD_TOC
+		data.summaryLayout.PayloadTocOffset = currentIdx;
 		data.header.PayloadTocOffset = readInt64();
 	}
 	else {
@@ -637,9 +1534,11 @@ bool Uasset::readHeader() {
 	}
 
 	if (data.header.FileVersionUE5 >= 0x0198) { // VER_UE5_DATA_RESOURCES
+		data.summaryLayout.DataResourceOffset = currentIdx;
 		data.header.DataResourceOffset = readInt32();
 	}
 
+	data.summaryLayout.end = currentIdx;
 	return true;
 }
 
@@ -647,12 +1546,24 @@ void Uasset::readNames() {
 	currentIdx = data.header.NameOffset;
 	data.names.clear();
 	for (int32_t i = 0; i < data.header.NameCount; ++i) {
-		UassetData::Name name;
-		name.Name = readFString();
-		name.NonCasePreservingHash = readUint16();
-		name.CasePreservingHash = readUint16();
-		data.names.push_back(name);
+		UassetData::Name name = reuse(spare.names);
+		readFString(name.Name);
+		SpanReader hashes = readSpan(2 * sizeof(uint16_t));
+		name.NonCasePreservingHash = hashes.read<uint16_t>();
+		name.CasePreservingHash = hashes.read<uint16_t>();
+		data.names.push_back(std::move(name));
 	}
+	data.summaryLayout.namesEnd = currentIdx;
+
+	if (options.verifyNameHashes) {
+		UassetData::NameIndex::HashCheck check = UassetData::NameIndex::verifyHashes(data.names);
+		if (!check.mismatches.empty()) {
+			uint32_t first = check.mismatches.front();
+			throw ParseException("Name table hash mismatch at name " + std::to_string(first) + " (" + data.names[first].Name + "), " +
+				std::to_string(check.mismatches.size()) + " of " + std::to_string(check.checked) + " names differ");
+		}
+	}
+	data.nameIndex.build(data.names);
 }
 
 bool Uasset::readGatherableTextData() {
@@ -699,149 +1610,505 @@ void Uasset::readImports() {
 	currentIdx = data.header.ImportOffset;
 	data.imports.clear();
 
+	// Import records are fixed-size for a given version, so each one is bounds-checked once
+	size_t recordSize = 3 * sizeof(int64_t) + sizeof(int32_t);
+	if (data.header.FileVersionUE4 >= 0x0166) { // VER_UE4_NON_OUTER_PACKAGE_IMPORT
+		recordSize += sizeof(int64_t);
+	}
+	if (data.header.FileVersionUE5 >= 0x0197) { // VER_UE5_OPTIONAL_RESOURCES
+		recordSize += sizeof(int32_t);
+	}
+
+	if (data.header.ImportCount > 0 && static_cast<size_t>(data.header.ImportCount) > bytesPtr->size() / recordSize) {
+		throw ParseException("Import table larger than file");
+	}
+	UassetData::ImportMap& map = data.importMap;
+	map.resize(data.header.ImportCount > 0 ? static_cast<size_t>(data.header.ImportCount) : 0);
+
 	for (int32_t i = 0; i < data.header.ImportCount; ++i) {
-		UassetData::Import importA;
+		UassetData::Import importA = reuse(spare.imports);
+		SpanReader record = readSpan(recordSize);
 
 		// Read indices and resolve names
-		int64_t classPackageIdx = readInt64();
-		int64_t classNameIdx = readInt64();
-		importA.outerIndex = readInt32();
-		int64_t objectNameIdx = readInt64();
-
-		importA.classPackage = resolveFName(classPackageIdx);
-		importA.className = resolveFName(classNameIdx);
-		importA.objectName = resolveFName(objectNameIdx);
+		int64_t classPackageIdx = record.read<int64_t>();
+		int64_t classNameIdx = record.read<int64_t>();
+		importA.outerIndex = record.read<int32_t>();
+		int64_t objectNameIdx = record.read<int64_t>();
+
+		// FNames are an index into the name table and a number in the upper half
+		assignFName(importA.classPackage, static_cast<int32_t>(classPackageIdx), static_cast<int32_t>(classPackageIdx >> 32));
+		assignFName(importA.className, static_cast<int32_t>(classNameIdx), static_cast<int32_t>(classNameIdx >> 32));
+		assignFName(importA.objectName, static_cast<int32_t>(objectNameIdx), static_cast<int32_t>(objectNameIdx >> 32));
+		map.classPackageIndex[i] = static_cast<int32_t>(classPackageIdx);
+		map.classNameIndex[i] = static_cast<int32_t>(classNameIdx);
+		map.outerIndex[i] = importA.outerIndex;
+		map.objectNameIndex[i] = static_cast<int32_t>(objectNameIdx);
 
 		if (data.header.FileVersionUE4 >= 0x0166) { // VER_UE4_NON_OUTER_PACKAGE_IMPORT
-			int64_t packageNameIdx = readInt64();
-			importA.packageName = resolveFName(packageNameIdx);
+			int64_t packageNameIdx = record.read<int64_t>();
+			assignFName(importA.packageName, static_cast<int32_t>(packageNameIdx), static_cast<int32_t>(packageNameIdx >> 32));
+			map.packageNameIndex[i] = static_cast<int32_t>(packageNameIdx);
 		}
 		else {
-			importA.packageName = "";
+			importA.packageName.clear();
 		}
 
 		if (data.header.FileVersionUE5 >= 0x0197) { // VER_UE5_OPTIONAL_RESOURCES
-			importA.bImportOptional = readInt32();
+			importA.bImportOptional = record.read<int32_t>();
 		}
 		else {
 			importA.bImportOptional = 0;
 		}
+		map.bImportOptional[i] = importA.bImportOptional;
 
-		data.imports.push_back(importA);
+		data.imports.push_back(std::move(importA));
 	}
 }
 
-void Uasset::readExports() {
-	currentIdx = data.header.ExportOffset;
-	data.exports.clear();
-	size_t prevCurrentIdx = currentIdx;
-	for (int32_t i = 0; i < data.header.ExportCount; ++i) {
-		currentIdx = prevCurrentIdx + i * 96;
-		UassetData::Export exportData;
-		exportData.internalIndex = i+1;
-		exportData.classIndex = readInt32();
-		exportData.superIndex = readInt32();
+// Runs reader once per parse; the read position is restored so callers can interleave
+// lazy sections with other reads. Returns false if the section is malformed.
+bool Uasset::decodeSection(UassetData::LazySection section, void (Uasset::* reader)()) {
+	if ((data.decodedSections & section) != 0) {
+		return true;
+	}
+	if (bytesPtr == nullptr) {
+		return false;   // nothing parsed, or the buffer was released
+	}
+	data.decodedSections |= section;
+
+	size_t savedIdx = currentIdx;
+	try {
+		(this->*reader)();
+	}
+	catch (const ParseException& e) {
+		std::cerr << e.what() << std::endl;
+		currentIdx = savedIdx;
+		return false;
+	}
+	currentIdx = savedIdx;
+	return true;
+}
+
+const std::vector<UassetData::SoftObjectPath>& Uasset::softObjectPaths() {
+	decodeSection(UassetData::SectionSoftObjectPaths, &Uasset::readSoftObjectPaths);
+	return data.softObjectPaths;
+}
+
+const std::vector<std::string>& Uasset::softPackageReferences() {
+	decodeSection(UassetData::SectionSoftPackageReferences, &Uasset::readSoftPackageReferences);
+	return data.softPackageReferences;
+}
+
+const std::vector<UassetData::SearchableNamesEntry>& Uasset::searchableNames() {
+	decodeSection(UassetData::SectionSearchableNames, &Uasset::readSearchableNames);
+	return data.searchableNames;
+}
+
+void Uasset::readSoftObjectPaths() {
+	data.softObjectPaths.clear();
+	if (data.header.SoftObjectPathsCount == 0 || data.header.SoftObjectPathsOffset == 0) {
+		return;
+	}
 
-		if (data.header.FileVersionUE4 >= 0x00AD) { // VER_UE4_TEMPLATEINDEX_IN_COOKED_EXPORTS
-			exportData.templateIndex = readInt32();
+	currentIdx = data.header.SoftObjectPathsOffset;
+	data.softObjectPaths.reserve(std::min<size_t>(data.header.SoftObjectPathsCount, bytesPtr->size() / 12));
+	for (uint32_t i = 0; i < data.header.SoftObjectPathsCount; ++i) {
+		UassetData::SoftObjectPath path;
+		if (data.header.FileVersionUE5 >= 0x03EF) { // VER_UE5_FSOFTOBJECTPATH_REMOVE_ASSET_PATH_FNAMES
+			path.packageName = resolveFName(readInt64());
+			path.assetName = resolveFName(readInt64());
 		}
 		else {
-			exportData.templateIndex = 0;
+			// Single AssetPathName of the form /Game/Package.Asset
+			const std::string& assetPath = resolveFName(readInt64());
+			size_t dot = assetPath.find('.');
+			path.packageName = assetPath.substr(0, dot);
+			path.assetName = dot != std::string::npos ? assetPath.substr(dot + 1) : std::string();
 		}
+		path.subPathString = readFString();
+		data.softObjectPaths.push_back(path);
+	}
+}
 
-		exportData.outerIndex = readInt32();
-		int32_t objectNameIdx = readInt32();
-		exportData.objectName = resolveFName(objectNameIdx);
-		currentIdx += 4; // undocumented
-		exportData.objectFlags = readUint32();
-		exportData.serialSize = readInt64Export();
-		exportData.serialOffset = readInt64Export();
-		exportData.bForcedExport = readInt32();
-		exportData.bNotForClient = readInt32();
-		exportData.bNotForServer = readInt32();
-		exportData.packageGuid = readGuid();
-		exportData.packageFlags = readUint32();
+void Uasset::readSoftPackageReferences() {
+	data.softPackageReferences.clear();
+	if (data.header.SoftPackageReferencesCount == 0 || data.header.SoftPackageReferencesOffset == 0) {
+		return;
+	}
 
-		if (data.header.FileVersionUE4 >= 0x00AC) { // VER_UE4_LOAD_FOR_EDITOR_GAME
-			exportData.bNotAlwaysLoadedForEditorGame = readInt32();
+	currentIdx = data.header.SoftPackageReferencesOffset;
+	for (uint32_t i = 0; i < data.header.SoftPackageReferencesCount; ++i) {
+		if (data.header.FileVersionUE4 >= 0x0202) { // VER_UE4_ADDED_SOFT_OBJECT_PATH
+			data.softPackageReferences.push_back(resolveFName(readInt64()));
 		}
 		else {
-			exportData.bNotAlwaysLoadedForEditorGame = 0;
+			data.softPackageReferences.push_back(readFString());
 		}
+	}
+}
+
+// TMap<FPackageIndex, TArray<FName>>: objects and the names they can be searched by
+void Uasset::readSearchableNames() {
+	data.searchableNames.clear();
+	if (data.header.SearchableNamesOffset <= 0) {
+		return;
+	}
 
-		if (data.header.FileVersionUE4 >= 0x00AE) { // VER_UE4_COOKED_ASSETS_IN_EDITOR_SUPPORT
-			exportData.bIsAsset = readInt32();
+	currentIdx = data.header.SearchableNamesOffset;
+	int32_t count = readInt32();
+	if (count < 0 || static_cast<size_t>(count) > (bytesPtr->size() - currentIdx) / 8) {
+		throw ParseException("Invalid searchable names count at " + std::to_string(currentIdx));
+	}
+	data.searchableNames.resize(count);
+	for (UassetData::SearchableNamesEntry& entry : data.searchableNames) {
+		entry.packageIndex = readInt32();
+		int32_t nameCount = readInt32();
+		if (nameCount < 0) {
+			throw ParseException("Invalid searchable names entry at " + std::to_string(currentIdx));
 		}
-		else {
-			exportData.bIsAsset = 0;
+		SpanReader span = readSpan(static_cast<size_t>(nameCount) * 8);
+		entry.names.reserve(nameCount);
+		for (int32_t i = 0; i < nameCount; ++i) {
+			entry.names.push_back(resolveFName(span.read<int64_t>()));
 		}
+	}
+}
 
-		if (data.header.FileVersionUE5 >= 0x0197) { // VER_UE5_OPTIONAL_RESOURCES
-			exportData.bGeneratePublicHash = readInt32();
+// Flat array of package indices; each export's four dependency lists start at its firstExportDependency
+void Uasset::readPreloadDependencies() {
+	data.preloadDependencies.clear();
+	if (data.header.PreloadDependencyCount <= 0 || data.header.PreloadDependencyOffset <= 0) {
+		return;
+	}
+
+	currentIdx = data.header.PreloadDependencyOffset;
+	SpanReader span = readSpan(static_cast<size_t>(data.header.PreloadDependencyCount) * sizeof(int32_t));
+	data.preloadDependencies.resize(data.header.PreloadDependencyCount);
+	for (int32_t& dependency : data.preloadDependencies) {
+		dependency = span.read<int32_t>();
+	}
+}
+
+// Decodes the whole export table into data.exportMap with a single bounds check
+void Uasset::readExportMap() {
+	const ExportRecordLayout layout = computeExportRecordLayout(data.header);
+	size_t count = data.header.ExportCount > 0 ? static_cast<size_t>(data.header.ExportCount) : 0;
+	if (count > bytesPtr->size() / layout.recordSize) {
+		throw ParseException("Export table larger than file");
+	}
+
+	currentIdx = data.header.ExportOffset;
+	SpanReader table = readSpan(layout.recordSize * count);
+
+	UassetData::ExportMap& map = data.exportMap;
+	map.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		map.classIndex[i] = table.read<int32_t>();
+		map.superIndex[i] = table.read<int32_t>();
+		if (layout.hasTemplateIndex) {
+			map.templateIndex[i] = table.read<int32_t>();
+		}
+		map.outerIndex[i] = table.read<int32_t>();
+		map.objectNameIndex[i] = table.read<int32_t>();
+		map.objectNameNumber[i] = table.read<int32_t>();
+		map.objectFlags[i] = table.read<uint32_t>();
+		if (layout.hasInt64SerialFields) {
+			map.serialSize[i] = table.read<int64_t>();
+			map.serialOffset[i] = table.read<int64_t>();
 		}
 		else {
-			exportData.bGeneratePublicHash = 0;
+			map.serialSize[i] = table.read<int32_t>();
+			map.serialOffset[i] = table.read<int32_t>();
 		}
-
-		if (data.header.FileVersionUE4 >= 0x0194) { // VER_UE4_PRELOAD_DEPENDENCIES_IN_COOKED_EXPORTS
-			exportData.firstExportDependency = readInt32();
-			exportData.serializationBeforeSerializationDependencies = readInt32();
-			exportData.createBeforeSerializationDependencies = readInt32();
-			exportData.serializationBeforeCreateDependencies = readInt32();
-			exportData.createBeforeCreateDependencies = readInt32();
+		map.bForcedExport[i] = table.read<int32_t>();
+		map.bNotForClient[i] = table.read<int32_t>();
+		map.bNotForServer[i] = table.read<int32_t>();
+		if (layout.hasPackageGuid) {
+			table.readGuid(map.packageGuid[i]);
 		}
-		else {
-			exportData.firstExportDependency = 0;
-			exportData.serializationBeforeSerializationDependencies = 0;
-			exportData.createBeforeSerializationDependencies = 0;
-			exportData.serializationBeforeCreateDependencies = 0;
-			exportData.createBeforeCreateDependencies = 0;
+		if (layout.hasIsInheritedInstance) {
+			map.bIsInheritedInstance[i] = table.read<int32_t>();
 		}
+		map.packageFlags[i] = table.read<uint32_t>();
+		if (layout.hasNotAlwaysLoadedForEditorGame) {
+			map.bNotAlwaysLoadedForEditorGame[i] = table.read<int32_t>();
+		}
+		if (layout.hasIsAsset) {
+			map.bIsAsset[i] = table.read<int32_t>();
+		}
+		if (layout.hasGeneratePublicHash) {
+			map.bGeneratePublicHash[i] = table.read<int32_t>();
+		}
+		if (layout.hasDependencies) {
+			map.firstExportDependency[i] = table.read<int32_t>();
+			map.serializationBeforeSerializationDependencies[i] = table.read<int32_t>();
+			map.createBeforeSerializationDependencies[i] = table.read<int32_t>();
+			map.serializationBeforeCreateDependencies[i] = table.read<int32_t>();
+			map.createBeforeCreateDependencies[i] = table.read<int32_t>();
+		}
+		if (layout.hasScriptSerializationOffsets) {
+			map.scriptSerializationStartOffset[i] = table.read<int64_t>();
+			map.scriptSerializationEndOffset[i] = table.read<int64_t>();
+		}
+	}
+}
+
+// Copies the export table record of export i (0-based) into exportData
+void Uasset::fillExportRecord(UassetData::Export& exportData, size_t i) {
+	const UassetData::ExportMap& map = data.exportMap;
+	exportData.internalIndex = static_cast<int>(i) + 1;
+	exportData.classIndex = map.classIndex[i];
+	exportData.superIndex = map.superIndex[i];
+	exportData.templateIndex = map.templateIndex[i];
+	exportData.outerIndex = map.outerIndex[i];
+	assignFName(exportData.objectName, map.objectNameIndex[i], map.objectNameNumber[i]);
+	exportData.objectFlags = map.objectFlags[i];
+	exportData.serialSize = map.serialSize[i];
+	exportData.serialOffset = map.serialOffset[i];
+	exportData.bForcedExport = map.bForcedExport[i];
+	exportData.bNotForClient = map.bNotForClient[i];
+	exportData.bNotForServer = map.bNotForServer[i];
+	exportData.packageGuid = map.packageGuid[i];
+	exportData.bIsInheritedInstance = map.bIsInheritedInstance[i];
+	exportData.packageFlags = map.packageFlags[i];
+	exportData.bNotAlwaysLoadedForEditorGame = map.bNotAlwaysLoadedForEditorGame[i];
+	exportData.bIsAsset = map.bIsAsset[i];
+	exportData.bGeneratePublicHash = map.bGeneratePublicHash[i];
+	exportData.firstExportDependency = map.firstExportDependency[i];
+	exportData.serializationBeforeSerializationDependencies = map.serializationBeforeSerializationDependencies[i];
+	exportData.createBeforeSerializationDependencies = map.createBeforeSerializationDependencies[i];
+	exportData.serializationBeforeCreateDependencies = map.serializationBeforeCreateDependencies[i];
+	exportData.createBeforeCreateDependencies = map.createBeforeCreateDependencies[i];
+	exportData.scriptSerializationStartOffset = map.scriptSerializationStartOffset[i];
+	exportData.scriptSerializationEndOffset = map.scriptSerializationEndOffset[i];
+}
+
+void Uasset::readExports() {
+	ParseProfile* prof = profiling();
+	{
+		ProfileScope scope(prof, ParseProfile::ExportMap, currentIdx, data.header.ExportOffset);
+		readExportMap();
+	}
+	data.exports.clear();
+	data.exports.reserve(data.exportMap.size());
+
+	for (size_t i = 0; i < data.exportMap.size(); ++i) {
+		UassetData::Export exportData = reuse(spare.exports);
+		fillExportRecord(exportData, i);
 
-		// Read the export data chunk
-		size_t previousIdx = currentIdx;
-		currentIdx = exportData.serialOffset;
-		exportData.chunkData = readCountBytes(exportData.serialSize);
-		currentIdx = previousIdx; // Reset index to continue reading next export
+		if (options.readExportData) {
+			ProfileScope scope(prof, ParseProfile::ExportData, currentIdx, static_cast<size_t>(exportData.serialOffset), &exportData.objectName);
+			// Read the export data chunk into the buffer the export already has
+			currentIdx = exportData.serialOffset;
+			copyBytes(exportData.chunkData, exportData.serialSize);
+			currentIdx += exportData.serialSize;
 
-		// Parse the export data
-		readExportData(exportData);
+			// Parse the export data
+			readExportData(exportData);
+		}
 
-		data.exports.push_back(exportData);
+		data.exports.push_back(std::move(exportData));
 	}
 }
 
 
-// Function to split 8 bytes into two 4-byte values
-uint32_t Uasset::lowerBytes(uint64_t value) {
-	// Extract the lowest 4 bytes (first half)
-	uint32_t lower = static_cast<uint32_t>(value & 0xFFFFFFFF);
-	return lower;
-}
+// Hashes the regions reparse() compares. A region outside the buffer hashes to 0, which never
+// counts as unchanged.
+UassetData::SectionChecksums Uasset::computeSectionChecksums() const {
+	const std::vector<uint8_t>& bytes = *bytesPtr;
+	auto hashRange = [&](int64_t begin, int64_t end) -> uint64_t {
+		if (begin < 0 || end < begin || static_cast<uint64_t>(end) > bytes.size()) {
+			return 0;
+		}
+		return hashBytes(bytes.data() + begin, static_cast<size_t>(end - begin));
+	};
 
-uint32_t Uasset::higherBytes(uint64_t value) {
-	// Extract the highest 4 bytes (second half)
-	uint32_t higher = static_cast<uint32_t>((value >> 32) & 0xFFFFFFFF);
-	return higher;
+	const UassetData::Header& header = data.header;
+	UassetData::SectionChecksums checksums;
+	checksums.valid = true;
+	checksums.names = hashRange(header.NameOffset, header.ImportOffset > header.NameOffset ? header.ImportOffset : header.TotalHeaderSize);
+	checksums.imports = hashRange(header.ImportOffset, header.ExportOffset);
+	const UassetData::ExportMap& map = data.exportMap;
+	checksums.exports.resize(map.size());
+	for (size_t i = 0; i < map.size(); ++i) {
+		checksums.exports[i] = hashRange(map.serialOffset[i], map.serialOffset[i] + map.serialSize[i]);
+	}
+	return checksums;
 }
 
-
-void Uasset::readExportData(UassetData::Export& exportData) {
-	size_t exportDataIdx = exportData.serialOffset;
-	currentIdx = exportDataIdx;
-	exportData.metadata.ObjectName = resolveFName(readInt64());
-	exportDataIdx += 8;
-	exportDataIdx = exportData.serialOffset;
-	currentIdx = exportDataIdx;
-	if (exportData.internalIndex == 18) {
-		int stop = 0;
+bool Uasset::reparse(const std::vector<uint8_t>& bytes) {
+	options.sectionChecksums = true;
+	lastReparse = ReparseStats();
+	if (!data.sectionChecksums.valid || !options.readExportData) {
+		bool parsed = parse(bytes);
+		lastReparse.exportsDecoded = data.exports.size();
+		return parsed;
 	}
-	// Loop until all data is read
-	while (exportDataIdx < (size_t)(exportData.serialOffset + exportData.serialSize)) {
 
-		int64_t val = readInt64();
-		if (val == 0) {
-			detectPaddingAfterNone();
+	UassetData previous = std::move(data);
+	data = UassetData();
+	currentIdx = 0;
+	bytesPtr = &bytes;
+
+	try {
+		if (!readHeader()) {
+			throw ParseException("Failed to read header");
+		}
+		readExportMap();
+		data.sectionChecksums = computeSectionChecksums();
+		const UassetData::SectionChecksums& before = previous.sectionChecksums;
+		const UassetData::SectionChecksums& after = data.sectionChecksums;
+
+		// Names feed every FName in the imports and export bodies. Other sections can be reused
+		// while every name index they hold still resolves to the same string, which is also true
+		// when names were only appended.
+		lastReparse.namesReused = after.names != 0 && after.names == before.names && data.header.NameOffset == previous.header.NameOffset;
+		if (lastReparse.namesReused) {
+			data.names = std::move(previous.names);
+			data.nameIndex = std::move(previous.nameIndex);
+			data.summaryLayout.namesEnd = previous.summaryLayout.namesEnd;
+		}
+		else {
+			readNames();
+			lastReparse.namesAppended = !previous.names.empty() && data.names.size() >= previous.names.size()
+				&& std::equal(previous.names.begin(), previous.names.end(), data.names.begin(),
+					[](const UassetData::Name& a, const UassetData::Name& b) { return a.Name == b.Name; });
+		}
+		const bool namesKept = lastReparse.namesReused || lastReparse.namesAppended;
+
+		if (!readGatherableTextData()) {
+			throw ParseException("Failed to read gatherable text data");
+		}
+
+		lastReparse.importsReused = namesKept && after.imports != 0 && after.imports == before.imports;
+		if (lastReparse.importsReused) {
+			data.imports = std::move(previous.imports);
+			data.importMap = std::move(previous.importMap);
+		}
+		else {
+			readImports();
+		}
+
+		// An export is reused when an export of the previous version had the same body, wherever
+		// it was; its recorded value offsets move with it. Previous exports are moved, and only
+		// copied while another new export still needs the same body.
+		std::unordered_map<uint64_t, size_t> previousByHash;
+		if (namesKept) {
+			for (size_t j = 0; j < before.exports.size() && j < previous.exports.size(); ++j) {
+				if (before.exports[j] != 0) {
+					previousByHash.emplace(before.exports[j], j);
+				}
+			}
+		}
+		const size_t none = SIZE_MAX;
+		std::vector<size_t> source(data.exportMap.size(), none);
+		std::vector<uint32_t> uses(previous.exports.size(), 0);
+		for (size_t i = 0; i < data.exportMap.size(); ++i) {
+			auto found = after.exports[i] != 0 ? previousByHash.find(after.exports[i]) : previousByHash.end();
+			if (found != previousByHash.end() && previous.exports[found->second].serialSize == data.exportMap.serialSize[i]) {
+				source[i] = found->second;
+				++uses[found->second];
+			}
+		}
+		data.exports.clear();
+		data.exports.reserve(data.exportMap.size());
+		for (size_t i = 0; i < data.exportMap.size(); ++i) {
+			UassetData::Export exportData;
+			if (source[i] != none) {
+				UassetData::Export& reused = previous.exports[source[i]];
+				if (--uses[source[i]] == 0) {
+					exportData = std::move(reused);
+				}
+				else {
+					exportData = reused;
+				}
+				int64_t shift = data.exportMap.serialOffset[i] - exportData.serialOffset;
+				fillExportRecord(exportData, i);
+				for (UassetData::Export::Property& property : exportData.properties) {
+					if (property.valueOffset >= 0) {
+						property.valueOffset += shift;
+					}
+				}
+				++lastReparse.exportsReused;
+			}
+			else {
+				fillExportRecord(exportData, i);
+				currentIdx = exportData.serialOffset;
+				exportData.chunkData = readCountBytes(exportData.serialSize);
+				readExportData(exportData);
+				++lastReparse.exportsDecoded;
+			}
+			data.exports.push_back(std::move(exportData));
+		}
+
+		readPreloadDependencies();
+		data.objectGraph.build(data);
+		if (options.readThumbnails) {
+			readThumbnails();
+		}
+		if (options.readAssetRegistry) {
+			readAssetRegistryData();
+		}
+		return true;
+	}
+	catch (const ParseException& e) {
+		std::cerr << e.what() << std::endl;
+		return false;
+	}
+}
+
+// Function to split 8 bytes into two 4-byte values
+uint32_t Uasset::lowerBytes(uint64_t value) {
+	// Extract the lowest 4 bytes (first half)
+	uint32_t lower = static_cast<uint32_t>(value & 0xFFFFFFFF);
+	return lower;
+}
+
+uint32_t Uasset::higherBytes(uint64_t value) {
+	// Extract the highest 4 bytes (second half)
+	uint32_t higher = static_cast<uint32_t>((value >> 32) & 0xFFFFFFFF);
+	return higher;
+}
+
+
+void Uasset::readExportData(UassetData::Export& exportData) {
+	size_t exportDataIdx = exportData.serialOffset;
+	currentIdx = exportDataIdx;
+	exportData.metadata.ObjectName = resolveFName(readInt64());
+	exportDataIdx += 8;
+	exportDataIdx = exportData.serialOffset;
+	currentIdx = exportDataIdx;
+	if (exportData.internalIndex == 18) {
+		int stop = 0;
+	}
+	size_t firstNewProperty = exportData.properties.size();
+	const size_t exportEnd = (size_t)(exportData.serialOffset + exportData.serialSize);
+	size_t tags = 0;
+	size_t decodedBytes = 0;
+	size_t previousTagStart = currentIdx;
+	const uint64_t byteBudget = static_cast<uint64_t>(options.maxExportReadRatio) * std::max<uint64_t>(static_cast<uint64_t>(std::max<int64_t>(exportData.serialSize, 0)), 4096);
+	// Loop until all data is read
+	while (exportDataIdx < exportEnd) {
+		// Handlers trust sizes from the file, so a bogus one can walk the cursor backwards and
+		// decode the same bytes again; the tag and byte budgets both bound that
+		if (options.maxTagsPerExport != 0 && ++tags > options.maxTagsPerExport) {
+			throw ParseException("Export " + std::to_string(exportData.internalIndex) + " exceeded the tag budget");
+		}
+		if (currentIdx > previousTagStart) {
+			decodedBytes += currentIdx - previousTagStart;
+		}
+		previousTagStart = currentIdx;
+		if (byteBudget != 0 && decodedBytes > byteBudget) {
+			throw ParseException("Export " + std::to_string(exportData.internalIndex) + " exceeded the byte budget");
+		}
+		firstNewProperty = exportData.properties.size();
+
+		size_t tagStart = currentIdx;
+		int64_t val = readInt64();
+		if (val == 0) {
+			detectPaddingAfterNone(exportEnd);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Padding, "padding");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 
@@ -851,20 +2118,22 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 			UassetData::Export::Property property;
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
-			exportData.properties.push_back(property);
+			readIntValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
-			exportData.properties.push_back(property);
+			readGuidValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
+			readIntValue(property);
 			//			exportData.properties.push_back(property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
+			readGuidValue(property);
 			//			exportData.properties.push_back(property);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Entity, "Entity");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 
@@ -873,20 +2142,22 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 			UassetData::Export::Property property;
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
-			exportData.properties.push_back(property);
+			readIntValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
-			exportData.properties.push_back(property);
+			readGuidValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
+			readIntValue(property);
 			//			exportData.properties.push_back(property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
+			readGuidValue(property);
 			//			exportData.properties.push_back(property);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Entity, "Entity");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 
@@ -895,20 +2166,22 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 			UassetData::Export::Property property;
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
-			exportData.properties.push_back(property);
+			readIntValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
-			exportData.properties.push_back(property);
+			readGuidValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
+			readIntValue(property);
 //			exportData.properties.push_back(property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
+			readGuidValue(property);
 //			exportData.properties.push_back(property);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Entity, "Entity");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 		if ((lowerBytes(val) == 0) && (higherBytes(val) == 4)) {
@@ -916,20 +2189,22 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 			UassetData::Export::Property property;
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
-			exportData.properties.push_back(property);
+			readIntValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
-			exportData.properties.push_back(property);
+			readGuidValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
+			readIntValue(property);
 			//			exportData.properties.push_back(property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
+			readGuidValue(property);
 			//			exportData.properties.push_back(property);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Entity, "Entity");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 
@@ -938,20 +2213,22 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 			UassetData::Export::Property property;
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
-			exportData.properties.push_back(property);
+			readIntValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
-			exportData.properties.push_back(property);
+			readGuidValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
+			readIntValue(property);
 			//			exportData.properties.push_back(property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
+			readGuidValue(property);
 			//			exportData.properties.push_back(property);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Entity, "Entity");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 
@@ -960,31 +2237,34 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 			UassetData::Export::Property property;
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
-			exportData.properties.push_back(property);
+			readIntValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
-			exportData.properties.push_back(property);
+			readGuidValue(property);
+			addProperty(exportData, property);
 			property.PropertyName = "Entity";
 			property.PropertyType = "int";
-			property.intValue = readInt32();;
+			readIntValue(property);
 			//			exportData.properties.push_back(property);
 			property.PropertyName = "Entity Guid";
 			property.PropertyType = "FString";
-			property.stringValue = readGuid();;
+			readGuidValue(property);
 			//			exportData.properties.push_back(property);
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Entity, "Entity");
+			exportDataIdx = currentIdx;
 			continue;
 		}
 
 
-		std::string ObjectClass = resolveFName(val);
+		const std::string& ObjectClass = resolveFName(val);
 		exportDataIdx += 8;
 
 		// Determine the structure type for the current segment of data
 		std::string structureType = determineStructureType(ObjectClass);
 
 		// Process the data based on the structure type
+		bool claimed = true;
 		if (structureType == "ParentClass") {
 			processParentClass(exportData, exportDataIdx);
 		}
@@ -1267,6 +2547,13 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 		else {
 			//break;
 			//processDefault(exportData, exportDataIdx);
+			claimed = structureType == "ParentClass";
+		}
+		if (claimed) {
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Handler, structureType.c_str());
+		}
+		else {
+			noteTag(exportData, tagStart, firstNewProperty, TagOutcome::Unclaimed, ObjectClass.c_str());
 		}
 
 		// Update the index based on how much data was processed in the loop
@@ -1275,6 +2562,96 @@ void Uasset::readExportData(UassetData::Export& exportData) {
 	}
 }
 
+// Counts the tag readExportData just consumed in the profile and adds its bytes, from tagStart
+// to the cursor, to the export's coverage. A handler that produced no property skipped them.
+void Uasset::noteTag(UassetData::Export& exportData, size_t tagStart, size_t firstProperty, TagOutcome outcome, const char* name) {
+	if (ParseProfile* prof = profiling()) {
+		switch (outcome) {
+		case TagOutcome::Padding:
+			++prof->paddingTags;
+			break;
+		case TagOutcome::Entity:
+			++prof->entityTags;
+			break;
+		case TagOutcome::Handler:
+			++prof->handlerTags[name];
+			break;
+		case TagOutcome::Unclaimed:
+			++prof->unknownTags[name];
+			break;
+		}
+	}
+	if (!options.coverage) {
+		return;
+	}
+
+	using Coverage = UassetData::Export::Coverage;
+	Coverage kind = Coverage::Decoded;
+	if (outcome == TagOutcome::Unclaimed) {
+		kind = Coverage::Unknown;
+	}
+	else if (outcome == TagOutcome::Padding || exportData.properties.size() == firstProperty) {
+		kind = Coverage::Skipped;
+	}
+	size_t bodyStart = static_cast<size_t>(exportData.serialOffset);
+	size_t begin = std::max(tagStart, bodyStart);
+	size_t end = std::min(currentIdx, bodyStart + static_cast<size_t>(exportData.serialSize));
+	if (end <= begin) {
+		return;
+	}
+	uint32_t offset = static_cast<uint32_t>(begin - bodyStart);
+	uint32_t length = static_cast<uint32_t>(end - begin);
+
+	// Unknown bytes are walked a name at a time, so everything up to the next claimed tag,
+	// zero words included, belongs to the unclaimed tag that started the run
+	std::vector<UassetData::Export::CoverageRun>& runs = exportData.coverage;
+	if (!runs.empty()) {
+		UassetData::Export::CoverageRun& last = runs.back();
+		bool adjacent = last.offset + last.length == offset;
+		if (adjacent && last.kind == Coverage::Unknown && outcome == TagOutcome::Padding) {
+			kind = Coverage::Unknown;
+		}
+		if (adjacent && last.kind == kind && (kind == Coverage::Unknown || last.tag == name)) {
+			last.length += length;
+			return;
+		}
+	}
+	runs.push_back({ offset, length, kind, name });
+}
+
+// Appends a copy of property built in a Property left over from an earlier parse, so the
+// copy lands in buffers that already exist. Copy assignment only sets the value field that
+// matches the type, so the slot is blanked first and ends up like a copy-constructed one.
+void Uasset::addProperty(UassetData::Export& exportData, const UassetData::Export::Property& property) {
+	if (spare.properties.empty()) {
+		exportData.properties.push_back(property);
+		return;
+	}
+	addProperty(exportData) = property;
+}
+
+// Appends a blank property for the handler to fill in place, so a recycled one keeps the
+// capacity of its strings instead of taking a copy of a handler-local property
+UassetData::Export::Property& Uasset::addProperty(UassetData::Export& exportData) {
+	if (spare.properties.empty()) {
+		exportData.properties.emplace_back();
+		return exportData.properties.back();
+	}
+	exportData.properties.push_back(std::move(spare.properties.back()));
+	spare.properties.pop_back();
+	UassetData::Export::Property& recycled = exportData.properties.back();
+	recycled.PropertyName.clear();
+	recycled.PropertyType.clear();
+	recycled.intValue = 0;
+	recycled.floatValue = 0;
+	recycled.boolValue = false;
+	recycled.stringValue.clear();
+	recycled.byteBuffer.clear();
+	recycled.valueOffset = -1;
+	recycled.valueSize = 0;
+	return recycled;
+}
+
 std::string Uasset::determineStructureType(const std::string& objectClass) {
 	// Logic to determine the structure type based on objectClass or other metadata
 	if (objectClass == "ParentClass") {
@@ -1574,50 +2951,58 @@ void Uasset::processGeneratedClass(UassetData::Export& exportData, size_t& expor
 		UassetData::Export::Property property;
 		property.PropertyName = "GeneratedClass ";
 		property.PropertyType = "int";
-		property.intValue = readInt32();
-		exportData.properties.push_back(property);
+		readIntValue(property);
+		addProperty(exportData, property);
 	}
 }
 
 void Uasset::processbCtrl(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bCtrl";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
 void Uasset::processbCmd(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bCmd";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 void Uasset::processInputKeyEvent(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
+	const std::string& subType = resolveFName(readInt64());
 	uint8_t flag = readByte();
-	std::string strValue = resolveFName(readInt64()); ;
+	const std::string& strValue = resolveFName(readInt64()); ;
 	if (exportData.metadata.ObjectType == "ByteProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "InputKeyEvent" + subType;
 		property.PropertyType = "FString";
 		property.stringValue = strValue;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -1630,7 +3015,7 @@ void Uasset::processFunctionNameToBind(UassetData::Export& exportData, size_t& e
 		property.PropertyName = "FunctionNameToBind";
 		property.PropertyType = "FString";
 		property.stringValue = resolveFName(readInt64());
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -1638,14 +3023,18 @@ void Uasset::processFunctionNameToBind(UassetData::Export& exportData, size_t& e
 void Uasset::processbConsumeInput(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bConsumeInput";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
@@ -1654,56 +3043,72 @@ void Uasset::processbConsumeInput(UassetData::Export& exportData, size_t& export
 void Uasset::processbExecuteWhenPaused(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bExecuteWhenPaused";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
 void Uasset::processbOverrideParentBinding(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bOverrideParentBinding";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
 void Uasset::processbShift(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bShift";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
 void Uasset::processbAlt(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bAlt";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
@@ -1711,38 +3116,47 @@ void Uasset::processbAlt(UassetData::Export& exportData, size_t& exportDataIdx)
 void Uasset::processbLegacyNeedToPurgeSkelRefs(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bLegacyNeedToPurgeSkelRefs ";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
 
 void Uasset::processPropertyGuids(UassetData::Export& exportData, size_t& exportDataIdx) {
-	exportData.metadata.ObjectType = resolveFName(readInt64());
-	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
-	std::string subType1 = resolveFName(readInt64());
-	uint8_t flag = readByte();
-	readInt32();
-	uint32_t numGuids = readInt32();
-	for (int i = 0; i < numGuids; i++) {
-		UassetData::Export::Property property;
+	SpanReader tagHeader = readSpan(4 * sizeof(int64_t) + sizeof(uint8_t) + 2 * sizeof(int32_t));
+	exportData.metadata.ObjectType = resolveFName(tagHeader.read<int64_t>());
+	int64_t size = tagHeader.read<int64_t>(); // read size
+	resolveFName(tagHeader.read<int64_t>());
+	resolveFName(tagHeader.read<int64_t>());
+	uint8_t flag = tagHeader.read<uint8_t>();
+	tagHeader.read<int32_t>();
+	uint32_t numGuids = tagHeader.read<uint32_t>();
+	// Maps can hold thousands of entries; both properties are filled in place
+	for (uint32_t i = 0; i < numGuids; i++) {
+		// Each entry is an FName followed by a GUID
+		SpanReader entry = readSpan(sizeof(int64_t) + 16);
+
+		UassetData::Export::Property& property = addProperty(exportData);
 		property.PropertyName = "PropertyGuids - Name";
 		property.PropertyType = "FString";
-		property.stringValue = resolveFName(readInt64());
-		exportData.properties.push_back(property);
-		
-		UassetData::Export::Property property2;
+		property.stringValue = resolveFName(entry.read<int64_t>());
+
+		UassetData::Export::Property& property2 = addProperty(exportData);
 		property2.PropertyName = "PropertyGuids - Guid";
 		property2.PropertyType = "FString";
-		property2.stringValue = readGuid();
-		exportData.properties.push_back(property2);
+		entry.readGuid(property2.stringValue);
+		property2.valueOffset = static_cast<int64_t>(currentIdx) - 16;
+		property2.valueSize = 16;
 	}
 
 	//std::string strValue = "";
@@ -1762,7 +3176,7 @@ void Uasset::processPropertyGuids(UassetData::Export& exportData, size_t& export
 void Uasset::processCategorySorting(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
+	const std::string& subType = resolveFName(readInt64());
 	uint8_t flag = readByte();
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "ArrayProperty") {
@@ -1770,8 +3184,8 @@ void Uasset::processCategorySorting(UassetData::Export& exportData, size_t& expo
 		property.PropertyName = "CategorySorting - " + subType;
 		property.PropertyType = "FString";
 		property.stringValue = "bytes";
-		property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-		exportData.properties.push_back(property);
+		copyBytes(property.byteBuffer, size);
+		addProperty(exportData, property);
 		currentIdx += size;
 	}
 }
@@ -1780,7 +3194,7 @@ void Uasset::processCategorySorting(UassetData::Export& exportData, size_t& expo
 void Uasset::processLastEditedDocuments(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
+	const std::string& subType = resolveFName(readInt64());
 	uint8_t flag = readByte();
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "ArrayProperty") {
@@ -1788,8 +3202,8 @@ void Uasset::processLastEditedDocuments(UassetData::Export& exportData, size_t&
 		property.PropertyName = "LastEditedDocuments - " + subType;
 		property.PropertyType = "FString";
 		property.stringValue = "bytes";
-		property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-		exportData.properties.push_back(property);
+		copyBytes(property.byteBuffer, size);
+		addProperty(exportData, property);
 		currentIdx += size;
 	}
 }
@@ -1797,7 +3211,7 @@ void Uasset::processLastEditedDocuments(UassetData::Export& exportData, size_t&
 void Uasset::processAdvancedPinDisplay(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 	uint8_t flag = readByte();
 	std::string  strValue = "";
 	if (exportData.metadata.ObjectType == "ByteProperty") {
@@ -1806,7 +3220,7 @@ void Uasset::processAdvancedPinDisplay(UassetData::Export& exportData, size_t& e
 		property.PropertyName = "AdvancedPinDisplay-"+subType;
 		property.PropertyType = "FString";
 		property.stringValue = strValue;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -1831,7 +3245,7 @@ void Uasset::processDefaultValue(UassetData::Export& exportData, size_t& exportD
 		property.PropertyName = "DefaultValue";
 		property.PropertyType = "FString";
 		property.stringValue = strValue;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -1839,7 +3253,7 @@ void Uasset::processDefaultValue(UassetData::Export& exportData, size_t& exportD
 void Uasset::processVarType(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
+	const std::string& subType = resolveFName(readInt64());
 	uint8_t flag = readByte();
 	std::string strValue = "";
 	readInt64(); // 
@@ -1848,42 +3262,41 @@ void Uasset::processVarType(UassetData::Export& exportData, size_t& exportDataId
 	property.PropertyName = subType;
 	property.PropertyType = "FString";
 	property.stringValue = "";
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 
-	std::string strPinCategory = resolveFName(readInt64());
+	const std::string& strPinCategory = resolveFName(readInt64());
 	UassetData::Export::Property property1;
 	property1.PropertyName = subType +"-PinCategory";
 	property1.PropertyType = "FString";
 	property1.stringValue = strPinCategory;
-	exportData.properties.push_back(property1);
+	addProperty(exportData, property1);
 
-	std::string strPinSubCategory = resolveFName(readInt64());
+	const std::string& strPinSubCategory = resolveFName(readInt64());
 	UassetData::Export::Property property2;
 	property2.PropertyName = subType + "-PinSubCategory";
 	property2.PropertyType = "FString";
 	property2.stringValue = strPinSubCategory;
-	exportData.properties.push_back(property2);
+	addProperty(exportData, property2);
 
-	int32_t strPinSubCategoryObject = readInt32();
 	UassetData::Export::Property property3;
 	property3.PropertyName = subType + "-PinSubCategoryObject";
 	property3.PropertyType = "int";
-	property3.intValue = strPinSubCategoryObject;
-	exportData.properties.push_back(property3);
+	readIntValue(property3);
+	addProperty(exportData, property3);
 
 	int8_t bIsArray = readByte();
 	UassetData::Export::Property property4;
 	property4.PropertyName = subType + "- bIsArray";
 	property4.PropertyType = "int";
 	property4.intValue = bIsArray;
-	exportData.properties.push_back(property4);
+	addProperty(exportData, property4);
 
 	int8_t bIsReference = readByte();
 	UassetData::Export::Property property5;
 	property5.PropertyName = subType + "- bIsReference";
 	property5.PropertyType = "int";
 	property5.intValue = bIsReference;
-	exportData.properties.push_back(property5);
+	addProperty(exportData, property5);
 
 
 	int8_t bIsConst = readByte();
@@ -1891,14 +3304,14 @@ void Uasset::processVarType(UassetData::Export& exportData, size_t& exportDataId
 	property6.PropertyName = subType + "- bIsConst";
 	property6.PropertyType = "int";
 	property6.intValue = bIsConst;
-	exportData.properties.push_back(property6);
+	addProperty(exportData, property6);
 
 	int8_t bIsWeakPointer = readByte();
 	UassetData::Export::Property property7;
 	property7.PropertyName = subType + "- bIsWeakPointer";
 	property7.PropertyType = "int";
 	property7.intValue = bIsWeakPointer;
-	exportData.properties.push_back(property7);
+	addProperty(exportData, property7);
 
 
 	int8_t bIsMap = readByte();
@@ -1906,14 +3319,14 @@ void Uasset::processVarType(UassetData::Export& exportData, size_t& exportDataId
 	property8.PropertyName = subType + "- bIsMap";
 	property8.PropertyType = "int";
 	property8.intValue = bIsMap;
-	exportData.properties.push_back(property8);
+	addProperty(exportData, property8);
 
 	int8_t bIsSet = readByte();
 	UassetData::Export::Property property9;
 	property9.PropertyName = subType + "- bIsSet";
 	property9.PropertyType = "int";
 	property9.intValue = bIsSet;
-	exportData.properties.push_back(property9);
+	addProperty(exportData, property9);
 
 
 	int8_t bIsWeak = readByte();
@@ -1921,14 +3334,14 @@ void Uasset::processVarType(UassetData::Export& exportData, size_t& exportDataId
 	property10.PropertyName = subType + "- bIsWeak";
 	property10.PropertyType = "int";
 	property10.intValue = bIsWeak;
-	exportData.properties.push_back(property10);
+	addProperty(exportData, property10);
 
 	int8_t bIsDelegate = readByte();
 	UassetData::Export::Property property11;
 	property11.PropertyName = subType + "- bIsDelegate";
 	property11.PropertyType = "int";
 	property11.intValue = bIsDelegate;
-	exportData.properties.push_back(property11);
+	addProperty(exportData, property11);
 
 
 	readInt32();
@@ -1961,7 +3374,7 @@ void Uasset::processVarName(UassetData::Export& exportData, size_t& exportDataId
 		property.PropertyName = "VarName";
 		property.PropertyType = "FString";
 		property.stringValue = strValue;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -1977,8 +3390,8 @@ void Uasset::processPropertyFlags(UassetData::Export& exportData, size_t& export
 		property.PropertyName = "PropertyFlags";
 		property.PropertyType = "UInt64Property";
 		property.stringValue = "bytes";
-		property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-		exportData.properties.push_back(property);
+		copyBytes(property.byteBuffer, size);
+		addProperty(exportData, property);
 	}
 }
 
@@ -1986,7 +3399,7 @@ void Uasset::processPropertyFlags(UassetData::Export& exportData, size_t& export
 void Uasset::processMetaDataArray(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
+	resolveFName(readInt64());
 	uint8_t flag = readByte();
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "ArrayProperty") {
@@ -1994,8 +3407,8 @@ void Uasset::processMetaDataArray(UassetData::Export& exportData, size_t& export
 		property.PropertyName = "MetaDataArray";
 		property.PropertyType = "FString";
 		property.stringValue = "bytes";
-		property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-		exportData.properties.push_back(property);
+		copyBytes(property.byteBuffer, size);
+		addProperty(exportData, property);
 		currentIdx += size;
 	}
 }
@@ -2004,7 +3417,7 @@ void Uasset::processMetaDataArray(UassetData::Export& exportData, size_t& export
 void Uasset::processReplicationCondition(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
+	resolveFName(readInt64());
 	uint8_t flag = readByte();
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "ByteProperty") {
@@ -2013,7 +3426,7 @@ void Uasset::processReplicationCondition(UassetData::Export& exportData, size_t&
 		property.PropertyName = "ReplicationCondition";
 		property.PropertyType = "FString";
 		property.stringValue = strValue;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2029,7 +3442,7 @@ void Uasset::processRepNotifyFunc(UassetData::Export& exportData, size_t& export
 		property.PropertyName = "RepNotifyFunc";
 		property.PropertyType = "FString";
 		property.stringValue = strValue;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2049,7 +3462,7 @@ void Uasset::processFriendlyName(UassetData::Export& exportData, size_t& exportD
 			property.PropertyName = "FriendlyName";
 			property.PropertyType = "FString";
 			property.stringValue = strValue;
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 		}
 	}
 }
@@ -2064,8 +3477,8 @@ void Uasset::processCategoryName(UassetData::Export& exportData, size_t& exportD
 		property.PropertyName = "CategoryName " ;
 		property.PropertyType = "FString";
 		property.stringValue = "bytes";
-		property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-		exportData.properties.push_back(property);
+		copyBytes(property.byteBuffer, size);
+		addProperty(exportData, property);
 		currentIdx += size;
 	}
 }
@@ -2089,7 +3502,7 @@ void Uasset::processCategory(UassetData::Export& exportData, size_t& exportDataI
 			property.PropertyName = "Category";
 			property.PropertyType = "FString";
 			property.stringValue = strValue;
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 		}
 	}
 }
@@ -2098,7 +3511,7 @@ void Uasset::processCategory(UassetData::Export& exportData, size_t& exportDataI
 void Uasset::processNewVariables(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subtype
+	const std::string& subType = resolveFName(readInt64()); // read subtype
 	int32_t value = 0;
 	if (exportData.metadata.ObjectType == "ArrayProperty") {
 		if (subType == "StructProperty") {
@@ -2126,13 +3539,13 @@ void Uasset::processDynamicBindingObjects(UassetData::Export& exportData, size_t
 	property.PropertyType = "int";
 	int count = readInt32();
 	property.intValue = count;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 
 	for (int i = 0; i < count; i++) {
 		property.PropertyName = "DynamicBindingObject[" + std::to_string(i) + "]";
 		property.PropertyType = "int";
-		property.intValue = readInt32();
-		exportData.properties.push_back(property);
+		readIntValue(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2140,8 +3553,8 @@ void Uasset::processDynamicBindingObjects(UassetData::Export& exportData, size_t
 void Uasset::processUberGraphFrame(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subtype
-	std::string subType1 = resolveFName(readInt64()); // read subtype1
+	const std::string& subType = resolveFName(readInt64()); // read subtype
+	resolveFName(readInt64()); // read subtype1
 	uint8_t flag = readByte();
 	int64_t value = 0;
 	
@@ -2152,7 +3565,7 @@ void Uasset::processUberGraphFrame(UassetData::Export& exportData, size_t& expor
 			property.PropertyName = "UberGraphFrame -" + subType;
 			property.PropertyType = "int";
 			property.intValue = readInt64();
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 		}
 	}
 }
@@ -2167,15 +3580,18 @@ void Uasset::processbCommentBubbleVisible_InDetailsPanel(UassetData::Export& exp
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64(); // read zeros
 
-	uint8_t flag = readByte();
-	uint8_t val = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal
+	readByte(); // HasPropertyGuid
 
 	UassetData::Export::Property property;
 	property.PropertyName = "bCommentBubbleVisible_InDetailsPanel-Value";
 	property.PropertyType = "bool";
-	property.boolValue = val;
+	property.boolValue = flag != 0;
+	property.valueOffset = static_cast<int64_t>(flagOffset);
+	property.valueSize = 1;
 	exportDataIdx += 4;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 void Uasset::processbCommentBubbleVisible(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
@@ -2186,14 +3602,18 @@ void Uasset::processbCommentBubbleVisible(UassetData::Export& exportData, size_t
 void Uasset::processbCommentBubblePinned(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bCommentBubblePinned";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
@@ -2208,34 +3628,42 @@ void Uasset::processbHiddenEdTemporary(UassetData::Export& exportData, size_t& e
 void Uasset::processbIsEditable(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bIsEditable";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 void Uasset::processbSelfContext(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bSelfContext";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
 // Function to detect padding after the None marker (9F 00 00 00 00 00 00 00)
-void Uasset::detectPaddingAfterNone() {
-	// Read until non-padding byte is found or the end of data
-	while (currentIdx < bytesPtr->size()) {
+void Uasset::detectPaddingAfterNone(size_t end) {
+	// Read until non-padding byte is found or the end of the export
+	while (currentIdx < std::min(end, bytesPtr->size())) {
 		uint8_t byte = readByte();
 
 		// Padding bytes are often zeroes or repeated values (e.g., 0x00)
@@ -2260,7 +3688,7 @@ void Uasset::processNone(UassetData::Export& exportData, size_t& exportDataIdx)
 void Uasset::processKey(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 
 	if (subType == "Key") {
 		uint64_t val = readInt64();
@@ -2270,7 +3698,7 @@ void Uasset::processKey(UassetData::Export& exportData, size_t& exportDataIdx) {
 		property.PropertyName = "Key-Value";
 		property.PropertyType = "int";
 		property.intValue = val;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2278,7 +3706,7 @@ void Uasset::processKey(UassetData::Export& exportData, size_t& exportDataIdx) {
 void Uasset::processInputChord(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 
 	if (subType == "InputChord") {
 		uint64_t val = readInt64();
@@ -2288,7 +3716,7 @@ void Uasset::processInputChord(UassetData::Export& exportData, size_t& exportDat
 		property.PropertyName = "InputChord-Value";
 		property.PropertyType = "int";
 		property.intValue = val;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2298,7 +3726,7 @@ void Uasset::processInputKeyDelegateBindings(UassetData::Export& exportData, siz
 		// Example:
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 
 	if (subType == "StructProperty") {
 		uint8_t flag = readByte();
@@ -2307,7 +3735,7 @@ void Uasset::processInputKeyDelegateBindings(UassetData::Export& exportData, siz
 		property.PropertyName = "InputKeyDelegateBindings-Value";
 		property.PropertyType = "int";
 		property.intValue = val;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	} 
 	else if (subType == "BlueprintInputKeyDelegateBinding") {
 
@@ -2318,24 +3746,24 @@ void Uasset::processInputKeyDelegateBindings(UassetData::Export& exportData, siz
 		property.PropertyName = "InputKeyDelegateBindings-Value";
 		property.PropertyType = "int";
 		property.intValue = 0;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
 void Uasset::processDelegateReference(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64());
-	std::string subType1 = resolveFName(readInt64());
+	const std::string& subType = resolveFName(readInt64());
+	resolveFName(readInt64());
 	uint8_t flag = readByte();
-	std::string valstr = resolveFName(readInt64());
+	const std::string& valstr = resolveFName(readInt64());
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "StructProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "DelegateReference - " + subType;
 		property.PropertyType = "FString";
 		property.stringValue = valstr;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2355,9 +3783,9 @@ void Uasset::processMemberParent(UassetData::Export& exportData, size_t& exportD
 	UassetData::Export::Property property;
 	property.PropertyName = "MemberParent(value)";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
+	readIntValue(property);
 	exportDataIdx += 4;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processMemberName(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2370,7 +3798,7 @@ void Uasset::processMemberName(UassetData::Export& exportData, size_t& exportDat
 	property.PropertyName = "MemberName(value)";
 	property.PropertyType = "FString";
 	property.stringValue = resolveFName(readInt64());
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 
@@ -2379,17 +3807,14 @@ void Uasset::processBlueprintSystemVersion(UassetData::Export& exportData, size_
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
 	uint8_t flag = readByte();  // read flag
-	int32_t value = 0;
-	
-	if (exportData.metadata.ObjectType == "IntProperty") {
-		value = readInt32();
-	}
     // add code to show value
 	UassetData::Export::Property property;
 	property.PropertyName = "BlueprintSystemVersion";
 	property.PropertyType = "int";
-	property.intValue = value;
-	exportData.properties.push_back(property);
+	if (exportData.metadata.ObjectType == "IntProperty") {
+		readIntValue(property);
+	}
+	addProperty(exportData, property);
 }
 
 void Uasset::processSimpleConstructionScript(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2397,17 +3822,14 @@ void Uasset::processSimpleConstructionScript(UassetData::Export& exportData, siz
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
 	uint8_t flag = readByte();  // read flag
-	int32_t value = 0;
-
-	if (exportData.metadata.ObjectType == "ObjectProperty") {
-		value = readInt32();
-	}
 	// add code to show value
 	UassetData::Export::Property property;
 	property.PropertyName = "SimpleConstructionScript";
 	property.PropertyType = "int";
-	property.intValue = value;
-	exportData.properties.push_back(property);
+	if (exportData.metadata.ObjectType == "ObjectProperty") {
+		readIntValue(property);
+	}
+	addProperty(exportData, property);
 }
 
 void Uasset::processUbergraphPages(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2415,7 +3837,7 @@ void Uasset::processUbergraphPages(UassetData::Export& exportData, size_t& expor
 	
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 	uint8_t flag = readByte();  // read flag
 	int32_t value = 0;
 
@@ -2427,14 +3849,14 @@ void Uasset::processUbergraphPages(UassetData::Export& exportData, size_t& expor
 			property.PropertyType = "int";
 			int count = readInt32();
 			property.intValue = count;
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 			exportDataIdx += 4;
 
 			for (int i = 0; i < count; i++) {
 				property.PropertyName = "UbergraphPage[" + std::to_string(i) + "]";
 				property.PropertyType = "int";
-				property.intValue = readInt32();
-				exportData.properties.push_back(property);
+				readIntValue(property);
+				addProperty(exportData, property);
 				exportDataIdx += 4;
 			}
 		}
@@ -2456,7 +3878,7 @@ void Uasset::processUberGraphFunction(UassetData::Export& exportData, size_t& ex
 		property.PropertyType = "int";
 		int count = readInt32();
 		property.intValue = count;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 		exportDataIdx += 4;
 	}
 }
@@ -2483,13 +3905,13 @@ void Uasset::processFunctionGraphs(UassetData::Export& exportData, size_t& expor
 	property.PropertyType = "int";
 	int count = readInt32();
 	property.intValue = count;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 
 	for (int i = 0; i < count; i++) {
 		property.PropertyName = "FunctionGraphs[" + std::to_string(i) + "]";
 		property.PropertyType = "int";
-		property.intValue = readInt32();
-		exportData.properties.push_back(property);
+		readIntValue(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2497,16 +3919,16 @@ void Uasset::processFunctionReference(UassetData::Export& exportData, size_t& ex
 
 	exportData.metadata.ObjectType = resolveFName(readInt64()); // read type
 	int64_t size = readInt64();
-	std::string subType = resolveFName(readInt64());
+	const std::string& subType = resolveFName(readInt64());
 	readByte(); //read flag
 	if (exportData.metadata.ObjectType == "StructProperty") {
 		if (subType == "MemberReference") {
-			std::string val = resolveFName(readInt64());
+			const std::string& val = resolveFName(readInt64());
 			UassetData::Export::Property property;
 			property.PropertyName = "FunctionReference";
 			property.PropertyType = "FString";
 			property.stringValue = val;
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 		}
 	}
 }
@@ -2521,14 +3943,18 @@ void Uasset::processbIsPureFunc(UassetData::Export& exportData, size_t& exportDa
 void Uasset::processbOverrideFunction(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bOverrideFunction";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
@@ -2536,14 +3962,18 @@ void Uasset::processbOverrideFunction(UassetData::Export& exportData, size_t& ex
 void Uasset::processbIsConstFunc(UassetData::Export& exportData, size_t& exportDataIdx) {
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	uint8_t flag = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal: a BoolProperty tag carries its value
 	std::string strValue = "";
 	if (exportData.metadata.ObjectType == "BoolProperty") {
 		UassetData::Export::Property property;
 		property.PropertyName = "bIsConstFunc";
 		property.PropertyType = "bool";
-		property.boolValue = readByte();
-		exportData.properties.push_back(property);
+		property.boolValue = flag != 0;
+		property.valueOffset = static_cast<int64_t>(flagOffset);
+		property.valueSize = 1;
+		readByte(); // HasPropertyGuid
+		addProperty(exportData, property);
 	}
 }
 
@@ -2556,8 +3986,8 @@ void Uasset::processNodePosX(UassetData::Export& exportData, size_t& exportDataI
 
 	property.PropertyName = "NodePosX";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processNodePosY(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2568,8 +3998,8 @@ void Uasset::processNodePosY(UassetData::Export& exportData, size_t& exportDataI
 
 	property.PropertyName = "NodePosY";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processNodeWidth(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2582,8 +4012,8 @@ void Uasset::processNodeWidth(UassetData::Export& exportData, size_t& exportData
 
 	property.PropertyName = "NodeWidth";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 
@@ -2596,8 +4026,8 @@ void Uasset::processNodeHeight(UassetData::Export& exportData, size_t& exportDat
 
 	property.PropertyName = "NodeHeight";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processNodeComment(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2609,7 +4039,7 @@ void Uasset::processNodeComment(UassetData::Export& exportData, size_t& exportDa
 	property.PropertyName = "NodeComment";
 	property.PropertyType = "FString";
 	property.stringValue = readFString();
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 	exportDataIdx += 4;
 }
 
@@ -2623,7 +4053,7 @@ void Uasset::processCustomFunctionName(UassetData::Export& exportData, size_t& e
 	property.stringValue = resolveFName(readInt64());
 
 	// Add the property to the export's properties vector
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processEventReference(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2643,9 +4073,9 @@ void Uasset::processExtraFlags(UassetData::Export& exportData, size_t& exportDat
 	UassetData::Export::Property property;
 	property.PropertyName = "ExtraFlagsValues";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
+	readIntValue(property);
 	exportDataIdx += 4;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 
@@ -2656,8 +4086,8 @@ void Uasset::processCustomClass(UassetData::Export& exportData, size_t& exportDa
 	UassetData::Export::Property property;
 	property.PropertyName = "CustomClass-Value";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processInputKey(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2668,7 +4098,7 @@ void Uasset::processInputKey(UassetData::Export& exportData, size_t& exportDataI
 	property.PropertyName = "InputKey";
 	property.PropertyType = "FString";
 	property.stringValue = resolveFName(readInt64());
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 
 	readInt64();
 	readInt64();
@@ -2684,7 +4114,7 @@ void Uasset::processKeyName(UassetData::Export& exportData, size_t& exportDataId
 	property.PropertyName = "KeyName";
 	property.PropertyType = "FString";
 	property.stringValue = resolveFName(readInt64());
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 
@@ -2703,7 +4133,7 @@ void Uasset::processbVisualizeComponent(UassetData::Export& exportData, size_t&
 
 	UassetData::Export::Property property;
 	property.PropertyName = resolveFName(readInt32());
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processComponentClass(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2714,8 +4144,8 @@ void Uasset::processComponentClass(UassetData::Export& exportData, size_t& expor
 	UassetData::Export::Property property;
 	property.PropertyName = "ComponentClass";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processComponentTemplate(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2727,8 +4157,8 @@ void Uasset::processComponentTemplate(UassetData::Export& exportData, size_t& ex
 	UassetData::Export::Property property;
 	property.PropertyName = "ComponentTemplate";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 
@@ -2742,7 +4172,7 @@ void Uasset::processInternalVariableName(UassetData::Export& exportData, size_t&
 	property.PropertyName = "InternalVariableName";
 	property.PropertyType = "FString";
 	property.stringValue = resolveFName(readInt64());
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 
@@ -2757,8 +4187,8 @@ void Uasset::processDefaultSceneRootNode(UassetData::Export& exportData, size_t&
 		UassetData::Export::Property property;
 		property.PropertyName = "DefaultSceneRootNode";
 		property.PropertyType = "int";
-		property.intValue = readInt32();
-		exportData.properties.push_back(property);
+		readIntValue(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2767,7 +4197,7 @@ void Uasset::processAllNodes(UassetData::Export& exportData, size_t& exportDataI
 
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 	uint8_t flag = readByte();  // read flag
 	int32_t value = 0;
 
@@ -2779,14 +4209,14 @@ void Uasset::processAllNodes(UassetData::Export& exportData, size_t& exportDataI
 			property.PropertyType = "int";
 			int count = readInt32();
 			property.intValue = count;
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 			exportDataIdx += 4;
 
 			for (int i = 0; i < count; i++) {
 				property.PropertyName = "AllNodes[" + std::to_string(i) + "]";
 				property.PropertyType = "int";
-				property.intValue = readInt32();
-				exportData.properties.push_back(property);
+				readIntValue(property);
+				addProperty(exportData, property);
 				exportDataIdx += 4;
 			}
 		}
@@ -2800,7 +4230,7 @@ void Uasset::processRootNodes(UassetData::Export& exportData, size_t& exportData
 
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64(); // read size
-	std::string subType = resolveFName(readInt64()); // read subType
+	const std::string& subType = resolveFName(readInt64()); // read subType
 	uint8_t flag = readByte();  // read flag
 	int32_t value = 0;
 
@@ -2812,14 +4242,14 @@ void Uasset::processRootNodes(UassetData::Export& exportData, size_t& exportData
 			property.PropertyType = "int";
 			int count = readInt32();
 			property.intValue = count;
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 			exportDataIdx += 4;
 
 			for (int i = 0; i < count; i++) {
 				property.PropertyName = "RootNodes[" + std::to_string(i) + "]";
 				property.PropertyType = "int";
-				property.intValue = readInt32();
-				exportData.properties.push_back(property);
+				readIntValue(property);
+				addProperty(exportData, property);
 				exportDataIdx += 4;
 			}
 		}
@@ -2841,13 +4271,13 @@ void Uasset::processNodes(UassetData::Export& exportData, size_t& exportDataIdx)
 	property.PropertyType = "int";
 	int count = readInt32();
 	property.intValue = count;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 
 	for (int i = 0; i < count; i++) {
 		property.PropertyName = "Node["+ std::to_string(i)+"]";
 		property.PropertyType = "int";
-		property.intValue = readInt32();
-		exportData.properties.push_back(property);
+		readIntValue(property);
+		addProperty(exportData, property);
 	}
 }
 
@@ -2857,16 +4287,15 @@ void Uasset::processBlueprintGuid(UassetData::Export& exportData, size_t& export
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64();
 
-	UassetData::Export::Property property;
-	property.PropertyName = resolveFName(readInt64()); //Guid 
-	std::string unknown1 = resolveFName(readInt64());
-	std::string unknown2 = resolveFName(readInt64());
+	resolveFName(readInt64()); //Guid 
+	resolveFName(readInt64());
+	resolveFName(readInt64());
 	readByte();
 
+	UassetData::Export::Property& property = addProperty(exportData);
 	property.PropertyName = "BlueprintGuid";
 	property.PropertyType = "FString";
-	property.stringValue = readGuid();
-	exportData.properties.push_back(property);
+	readGuidValue(property);
 }
 
 void Uasset::processGraphGuid(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2874,16 +4303,15 @@ void Uasset::processGraphGuid(UassetData::Export& exportData, size_t& exportData
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64();
 
-	UassetData::Export::Property property;
-	property.PropertyName = resolveFName(readInt64()); //Guid 
-	std::string unknown1 = resolveFName(readInt64());
-	std::string unknown2 = resolveFName(readInt64());
+	resolveFName(readInt64()); //Guid 
+	resolveFName(readInt64());
+	resolveFName(readInt64());
 	readByte();
 	
+	UassetData::Export::Property& property = addProperty(exportData);
 	property.PropertyName = "GraphGuid";
 	property.PropertyType = "FString";
-	property.stringValue = readGuid();
-	exportData.properties.push_back(property);
+	readGuidValue(property);
 }
 
 void Uasset::processVarGuid(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2891,15 +4319,14 @@ void Uasset::processVarGuid(UassetData::Export& exportData, size_t& exportDataId
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64();
 
-	UassetData::Export::Property property;
-	property.PropertyName = resolveFName(readInt64()); //Guid 
-	std::string unknown1 = resolveFName(readInt64());
-	std::string unknown2 = resolveFName(readInt64());
+	resolveFName(readInt64()); //Guid 
+	resolveFName(readInt64());
+	resolveFName(readInt64());
 	readByte();
+	UassetData::Export::Property& property = addProperty(exportData);
 	property.PropertyName = "VarGuid";
 	property.PropertyType = "FString";
-	property.stringValue = readGuid();
-	exportData.properties.push_back(property);
+	readGuidValue(property);
 }
 
 void Uasset::processVariableGuid(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2907,15 +4334,14 @@ void Uasset::processVariableGuid(UassetData::Export& exportData, size_t& exportD
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64();
 
-	UassetData::Export::Property property;
-	property.PropertyName = resolveFName(readInt64()); //Guid 
-	std::string unknown1 = resolveFName(readInt64());
-	std::string unknown2 = resolveFName(readInt64());
+	resolveFName(readInt64()); //Guid 
+	resolveFName(readInt64());
+	resolveFName(readInt64());
 	readByte();
+	UassetData::Export::Property& property = addProperty(exportData);
 	property.PropertyName = "VariableGuid";
 	property.PropertyType = "FString";
-	property.stringValue = readGuid();
-	exportData.properties.push_back(property);
+	readGuidValue(property);
 }
 
 void Uasset::processNodeGuid(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2923,15 +4349,14 @@ void Uasset::processNodeGuid(UassetData::Export& exportData, size_t& exportDataI
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64();
 
-	UassetData::Export::Property property;
-	property.PropertyName = resolveFName(readInt64()); //Guid 
-	std::string unknown1 = resolveFName(readInt64());
-	std::string unknown2 = resolveFName(readInt64());
+	resolveFName(readInt64()); //Guid 
+	resolveFName(readInt64());
+	resolveFName(readInt64());
 	readByte();
+	UassetData::Export::Property& property = addProperty(exportData);
 	property.PropertyName = "NodeGuid";
 	property.PropertyType = "FString";
-	property.stringValue = readGuid();
-	exportData.properties.push_back(property);
+	readGuidValue(property);
 }
 
 void Uasset::processMemberGuid(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2939,31 +4364,30 @@ void Uasset::processMemberGuid(UassetData::Export& exportData, size_t& exportDat
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64();
 
-	UassetData::Export::Property property;
-	property.PropertyName = resolveFName(readInt64()); //Guid 
-	std::string unknown1 = resolveFName(readInt64());
-	std::string unknown2 = resolveFName(readInt64());
+	resolveFName(readInt64()); //Guid 
+	resolveFName(readInt64());
+	resolveFName(readInt64());
 	readByte();
 
+	UassetData::Export::Property& property = addProperty(exportData);
 	property.PropertyName = "MemberGuid";
 	property.PropertyType = "FString";
-	property.stringValue = readGuid();
-	exportData.properties.push_back(property);
+	readGuidValue(property);
 }
 
 void Uasset::processEnabledState(UassetData::Export& exportData, size_t& exportDataIdx) {
 
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	int64_t size = readInt64();
-	std::string subType = resolveFName(readInt64());
+	resolveFName(readInt64());
 	int8_t flag = readByte();
-	std::string value = resolveFName(readInt64());
+	const std::string& value = resolveFName(readInt64());
 
 	UassetData::Export::Property property;
 	property.PropertyName = "EnabledState";
 	property.PropertyType = "FString";
 	property.stringValue = value;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processTransformComponent(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2975,8 +4399,8 @@ void Uasset::processTransformComponent(UassetData::Export& exportData, size_t& e
 	UassetData::Export::Property property;
 	property.PropertyName = "TransformComponent-Value";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
-	exportData.properties.push_back(property);
+	readIntValue(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processOutputDelegate(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -2996,7 +4420,7 @@ void Uasset::processOutputDelegate(UassetData::Export& exportData, size_t& expor
 		property.PropertyType = "FString";
 		property.stringValue = str1;
 		if (str1 != "") {
-			exportData.properties.push_back(property);
+			addProperty(exportData, property);
 		}
 
 		UassetData::Export::Property property2;
@@ -3004,14 +4428,14 @@ void Uasset::processOutputDelegate(UassetData::Export& exportData, size_t& expor
 		property2.PropertyType = "FString";
 		property2.stringValue = str2;
 		if (str2 != "") {
-			exportData.properties.push_back(property2);
+			addProperty(exportData, property2);
 		}
 		UassetData::Export::Property property3;
 		property3.PropertyName = "OutputDelegate - info3";
 		property3.PropertyType = "FString";
 		property3.stringValue = str3;
 		if (str3 != "") {
-			exportData.properties.push_back(property3);
+			addProperty(exportData, property3);
 		}
 
 		UassetData::Export::Property property4;
@@ -3019,7 +4443,7 @@ void Uasset::processOutputDelegate(UassetData::Export& exportData, size_t& expor
 		property4.PropertyType = "FString";
 		property4.stringValue = str4;
 		if (str4 != "") {
-			exportData.properties.push_back(property4);
+			addProperty(exportData, property4);
 		}
 	}
 	else if (val1 == 0) {
@@ -3034,7 +4458,7 @@ void Uasset::processOutputDelegate(UassetData::Export& exportData, size_t& expor
 		property41.PropertyType = "FString";
 		property41.stringValue = str41;
 		if (str41 != "") {
-			exportData.properties.push_back(property41);
+			addProperty(exportData, property41);
 		}
 	}
 }
@@ -3055,24 +4479,24 @@ void Uasset::processDelegate(UassetData::Export& exportData, size_t& exportDataI
 		property.PropertyName = "Delegate - info1";
 		property.PropertyType = "FString";
 		property.stringValue = str1;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 
 		UassetData::Export::Property property2;
 		property2.PropertyName = "Delegate - info2";
 		property2.PropertyType = "FString";
 		property2.stringValue = str2;
-		exportData.properties.push_back(property2);
+		addProperty(exportData, property2);
 		UassetData::Export::Property property3;
 		property3.PropertyName = "Delegate - info3";
 		property3.PropertyType = "FString";
 		property3.stringValue = str3;
-		exportData.properties.push_back(property3);
+		addProperty(exportData, property3);
 
 		UassetData::Export::Property property4;
 		property4.PropertyName = "Delegate - info4";
 		property4.PropertyType = "FString";
 		property4.stringValue = str4;
-		exportData.properties.push_back(property4);
+		addProperty(exportData, property4);
 	}
 	else if (val1 == 0) {
 		readInt32();
@@ -3085,7 +4509,7 @@ void Uasset::processDelegate(UassetData::Export& exportData, size_t& exportDataI
 		property41.PropertyName = "Delegate - info4";
 		property41.PropertyType = "FString";
 		property41.stringValue = str41;
-		exportData.properties.push_back(property41);
+		addProperty(exportData, property41);
 	}
 }
 
@@ -3105,24 +4529,24 @@ void Uasset::processthen(UassetData::Export& exportData, size_t& exportDataIdx)
 		property.PropertyName = "Then - info1";
 		property.PropertyType = "FString";
 		property.stringValue = str1;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 
 		UassetData::Export::Property property2;
 		property2.PropertyName = "Then - info2";
 		property2.PropertyType = "FString";
 		property2.stringValue = str2;
-		exportData.properties.push_back(property2);
+		addProperty(exportData, property2);
 		UassetData::Export::Property property3;
 		property3.PropertyName = "Then - info3";
 		property3.PropertyType = "FString";
 		property3.stringValue = str3;
-		exportData.properties.push_back(property3);
+		addProperty(exportData, property3);
 
 		UassetData::Export::Property property4;
 		property4.PropertyName = "Then - info4";
 		property4.PropertyType = "FString";
 		property4.stringValue = str4;
-		exportData.properties.push_back(property4);
+		addProperty(exportData, property4);
 	}
 	else if (val1 == 0) {
 		readInt32();
@@ -3135,7 +4559,7 @@ void Uasset::processthen(UassetData::Export& exportData, size_t& exportDataIdx)
 		property41.PropertyName = "Then - info4";
 		property41.PropertyType = "FString";
 		property41.stringValue = str41;
-			exportData.properties.push_back(property41);
+			addProperty(exportData, property41);
 	}
 }
 
@@ -3157,24 +4581,24 @@ void Uasset::processself(UassetData::Export& exportData, size_t& exportDataIdx)
 		property.PropertyName = "Self - info1";
 		property.PropertyType = "FString";
 		property.stringValue = str1;
-		exportData.properties.push_back(property);
+		addProperty(exportData, property);
 
 		UassetData::Export::Property property2;
 		property2.PropertyName = "Self - info2";
 		property2.PropertyType = "FString";
 		property2.stringValue = str2;
-		exportData.properties.push_back(property2);
+		addProperty(exportData, property2);
 		UassetData::Export::Property property3;
 		property3.PropertyName = "Self - info3";
 		property3.PropertyType = "FString";
 		property3.stringValue = str3;
-		exportData.properties.push_back(property3);
+		addProperty(exportData, property3);
 
 		UassetData::Export::Property property4;
 		property4.PropertyName = "Self - info4";
 		property4.PropertyType = "FString";
 		property4.stringValue = str4;
-		exportData.properties.push_back(property4);
+		addProperty(exportData, property4);
 	}
 	else if (val1 == 0) {
 		readInt32();
@@ -3187,7 +4611,7 @@ void Uasset::processself(UassetData::Export& exportData, size_t& exportDataIdx)
 		property41.PropertyName = "Self - info4";
 		property41.PropertyType = "FString";
 		property41.stringValue = str41;
-		exportData.properties.push_back(property41);
+		addProperty(exportData, property41);
 	}
 }
 
@@ -3199,8 +4623,8 @@ void Uasset::processdelegate(UassetData::Export& exportData, size_t& exportDataI
 	property.PropertyName = "delegate";
 	property.PropertyType = "FString";
 	property.stringValue = "bytes";
-	property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-	exportData.properties.push_back(property);
+	copyBytes(property.byteBuffer, size);
+	addProperty(exportData, property);
 	currentIdx += size;
 
 	if (readInt64() == 1) {
@@ -3208,13 +4632,13 @@ void Uasset::processdelegate(UassetData::Export& exportData, size_t& exportDataI
 		UassetData::Export::Property property1;
 		property1.PropertyName = "delegate - Entity";
 		property1.PropertyType = "int";
-		property1.intValue = readInt32();;
-		exportData.properties.push_back(property1);
+		readIntValue(property1);
+		addProperty(exportData, property1);
 		UassetData::Export::Property property2;
 		property2.PropertyName = "delegate - Entity Guid";
 		property2.PropertyType = "FString";
-		property2.stringValue = readGuid();;
-		exportData.properties.push_back(property2);
+		readGuidValue(property2);
+		addProperty(exportData, property2);
 
 		// read 36 bytes
 		int size3 = 36;
@@ -3222,8 +4646,8 @@ void Uasset::processdelegate(UassetData::Export& exportData, size_t& exportDataI
 		property3.PropertyName = "delegate - 36 bytes unknown";
 		property3.PropertyType = "FString";
 		property3.stringValue = "bytes";
-		property3.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size3);
-		exportData.properties.push_back(property3);
+		copyBytes(property3.byteBuffer, size3);
+		addProperty(exportData, property3);
 		currentIdx += size3;
 
 
@@ -3231,22 +4655,22 @@ void Uasset::processdelegate(UassetData::Export& exportData, size_t& exportDataI
 		UassetData::Export::Property property4;
 		property4.PropertyName = "delegate - Entity";
 		property4.PropertyType = "int";
-		property4.intValue = readInt32();;
-		exportData.properties.push_back(property4);
+		readIntValue(property4);
+		addProperty(exportData, property4);
 		property4.PropertyName = "delegate - Entity Guid";
 		property4.PropertyType = "FString";
-		property4.stringValue = readGuid();;
-		exportData.properties.push_back(property4);
+		readGuidValue(property4);
+		addProperty(exportData, property4);
 
 		// read entity and guid value
 		UassetData::Export::Property property5;
 		property5.PropertyName = "delegate - Entity";
 		property5.PropertyType = "int";
-		property5.intValue = readInt32();;
+		readIntValue(property5);
 		//	exportData.properties.push_back(property5);
 		property5.PropertyName = "delegate - Entity Guid";
 		property5.PropertyType = "FString";
-		property5.stringValue = readGuid();;
+		readGuidValue(property5);
 		//	exportData.properties.push_back(property5);
 	}
 	else if (readInt64() == 0) {
@@ -3256,30 +4680,30 @@ void Uasset::processdelegate(UassetData::Export& exportData, size_t& exportDataI
 		property31.PropertyName = "delegate - 36 bytes unknown";
 		property31.PropertyType = "FString";
 		property31.stringValue = "bytes";
-		property31.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size31);
-		exportData.properties.push_back(property31);
+		copyBytes(property31.byteBuffer, size31);
+		addProperty(exportData, property31);
 		currentIdx += size31;
 
 		// read entity and guid value
 		UassetData::Export::Property property41;
 		property41.PropertyName = "delegate - Entity";
 		property41.PropertyType = "int";
-		property41.intValue = readInt32();;
-		exportData.properties.push_back(property41);
+		readIntValue(property41);
+		addProperty(exportData, property41);
 		property41.PropertyName = "delegate - Entity Guid";
 		property41.PropertyType = "FString";
-		property41.stringValue = readGuid();;
-		exportData.properties.push_back(property41);
+		readGuidValue(property41);
+		addProperty(exportData, property41);
 
 		// read entity and guid value
 		UassetData::Export::Property property51;
 		property51.PropertyName = "delegate - Entity";
 		property51.PropertyType = "int";
-		property51.intValue = readInt32();;
+		readIntValue(property51);
 		//	exportData.properties.push_back(property5);
 		property51.PropertyName = "delegate - Entity Guid";
 		property51.PropertyType = "FString";
-		property51.stringValue = readGuid();;
+		readGuidValue(property51);
 		//	exportData.properties.push_back(property5);
 
 	}
@@ -3296,8 +4720,8 @@ void Uasset::processobject(UassetData::Export& exportData, size_t& exportDataIdx
 	property.PropertyName = "object";
 	property.PropertyType = "FString";
 	property.stringValue = "bytes";
-	property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-	exportData.properties.push_back(property);
+	copyBytes(property.byteBuffer, size);
+	addProperty(exportData, property);
 	currentIdx += size;
 
 	if (readInt64() == 1) {
@@ -3305,13 +4729,13 @@ void Uasset::processobject(UassetData::Export& exportData, size_t& exportDataIdx
 		UassetData::Export::Property property1;
 		property1.PropertyName = "object - Entity";
 		property1.PropertyType = "int";
-		property1.intValue = readInt32();;
-		exportData.properties.push_back(property1);
+		readIntValue(property1);
+		addProperty(exportData, property1);
 		UassetData::Export::Property property2;
 		property2.PropertyName = "object - Entity Guid";
 		property2.PropertyType = "FString";
-		property2.stringValue = readGuid();;
-		exportData.properties.push_back(property2);
+		readGuidValue(property2);
+		addProperty(exportData, property2);
 
 		// read 36 bytes
 		int size3 = 36;
@@ -3319,30 +4743,30 @@ void Uasset::processobject(UassetData::Export& exportData, size_t& exportDataIdx
 		property3.PropertyName = "object - 36 bytes unknown";
 		property3.PropertyType = "FString";
 		property3.stringValue = "bytes";
-		property3.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size3);
-		exportData.properties.push_back(property3);
+		copyBytes(property3.byteBuffer, size3);
+		addProperty(exportData, property3);
 		currentIdx += size3;
 
 		// read entity and guid value
 		UassetData::Export::Property property4;
 		property4.PropertyName = "object - Entity";
 		property4.PropertyType = "int";
-		property4.intValue = readInt32();;
-		exportData.properties.push_back(property4);
+		readIntValue(property4);
+		addProperty(exportData, property4);
 		property4.PropertyName = "object - Entity Guid";
 		property4.PropertyType = "FString";
-		property4.stringValue = readGuid();;
-		exportData.properties.push_back(property4);
+		readGuidValue(property4);
+		addProperty(exportData, property4);
 
 		// read entity and guid value
 		UassetData::Export::Property property5;
 		property5.PropertyName = "object - Entity";
 		property5.PropertyType = "int";
-		property5.intValue = readInt32();;
+		readIntValue(property5);
 		//	exportData.properties.push_back(property5);
 		property5.PropertyName = "object - Entity Guid";
 		property5.PropertyType = "FString";
-		property5.stringValue = readGuid();;
+		readGuidValue(property5);
 		//	exportData.properties.push_back(property5);
 	}
 	else if (readInt64() == 0) {
@@ -3352,30 +4776,30 @@ void Uasset::processobject(UassetData::Export& exportData, size_t& exportDataIdx
 		property31.PropertyName = "object - 36 bytes unknown";
 		property31.PropertyType = "FString";
 		property31.stringValue = "bytes";
-		property31.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size31);
-		exportData.properties.push_back(property31);
+		copyBytes(property31.byteBuffer, size31);
+		addProperty(exportData, property31);
 		currentIdx += size31;
 
 		// read entity and guid value
 		UassetData::Export::Property property41;
 		property41.PropertyName = "object - Entity";
 		property41.PropertyType = "int";
-		property41.intValue = readInt32();;
-		exportData.properties.push_back(property41);
+		readIntValue(property41);
+		addProperty(exportData, property41);
 		property41.PropertyName = "object - Entity Guid";
 		property41.PropertyType = "FString";
-		property41.stringValue = readGuid();;
-		exportData.properties.push_back(property41);
+		readGuidValue(property41);
+		addProperty(exportData, property41);
 
 		// read entity and guid value
 		UassetData::Export::Property property51;
 		property51.PropertyName = "object - Entity";
 		property51.PropertyType = "int";
-		property51.intValue = readInt32();;
+		readIntValue(property51);
 		//	exportData.properties.push_back(property5);
 		property51.PropertyName = "object - Entity Guid";
 		property51.PropertyType = "FString";
-		property51.stringValue = readGuid();;
+		readGuidValue(property51);
 		//	exportData.properties.push_back(property5);
 	}
 	else {
@@ -3392,8 +4816,8 @@ void Uasset::processexec(UassetData::Export& exportData, size_t& exportDataIdx)
 	property.PropertyName = "Exec";
 	property.PropertyType = "FString";
 	property.stringValue = "bytes";
-	property.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size);
-	exportData.properties.push_back(property);
+	copyBytes(property.byteBuffer, size);
+	addProperty(exportData, property);
 	currentIdx += size;
 	
 	if (readInt64() == 1) {
@@ -3401,13 +4825,13 @@ void Uasset::processexec(UassetData::Export& exportData, size_t& exportDataIdx)
 		UassetData::Export::Property property1;
 		property1.PropertyName = "Exec - Entity";
 		property1.PropertyType = "int";
-		property1.intValue = readInt32();;
-		exportData.properties.push_back(property1);
+		readIntValue(property1);
+		addProperty(exportData, property1);
 		UassetData::Export::Property property2;
 		property2.PropertyName = "Exec - Entity Guid";
 		property2.PropertyType = "FString";
-		property2.stringValue = readGuid();;
-		exportData.properties.push_back(property2);
+		readGuidValue(property2);
+		addProperty(exportData, property2);
 
 		// read 36 bytes
 		int size3 = 36;
@@ -3415,30 +4839,30 @@ void Uasset::processexec(UassetData::Export& exportData, size_t& exportDataIdx)
 		property3.PropertyName = "Exec - 36 bytes unknown";
 		property3.PropertyType = "FString";
 		property3.stringValue = "bytes";
-		property3.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size3);
-		exportData.properties.push_back(property3);
+		copyBytes(property3.byteBuffer, size3);
+		addProperty(exportData, property3);
 		currentIdx += size3;
 
 		// read entity and guid value
 		UassetData::Export::Property property4;
 		property4.PropertyName = "Exec - Entity";
 		property4.PropertyType = "int";
-		property4.intValue = readInt32();;
-		exportData.properties.push_back(property4);
+		readIntValue(property4);
+		addProperty(exportData, property4);
 		property4.PropertyName = "Exec - Entity Guid";
 		property4.PropertyType = "FString";
-		property4.stringValue = readGuid();;
-		exportData.properties.push_back(property4);
+		readGuidValue(property4);
+		addProperty(exportData, property4);
 
 		// read entity and guid value
 		UassetData::Export::Property property5;
 		property5.PropertyName = "Exec - Entity";
 		property5.PropertyType = "int";
-		property5.intValue = readInt32();;
+		readIntValue(property5);
 		//	exportData.properties.push_back(property5);
 		property5.PropertyName = "Exec - Entity Guid";
 		property5.PropertyType = "FString";
-		property5.stringValue = readGuid();;
+		readGuidValue(property5);
 		//	exportData.properties.push_back(property5);
 	}
 	else if (readInt64() == 0) {
@@ -3448,30 +4872,30 @@ void Uasset::processexec(UassetData::Export& exportData, size_t& exportDataIdx)
 		property31.PropertyName = "Exec - 36 bytes unknown";
 		property31.PropertyType = "FString";
 		property31.stringValue = "bytes";
-		property31.byteBuffer.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + size31);
-		exportData.properties.push_back(property31);
+		copyBytes(property31.byteBuffer, size31);
+		addProperty(exportData, property31);
 		currentIdx += size31;
 
 		// read entity and guid value
 		UassetData::Export::Property property41;
 		property41.PropertyName = "Exec - Entity";
 		property41.PropertyType = "int";
-		property41.intValue = readInt32();;
-		exportData.properties.push_back(property41);
+		readIntValue(property41);
+		addProperty(exportData, property41);
 		property41.PropertyName = "Exec - Entity Guid";
 		property41.PropertyType = "FString";
-		property41.stringValue = readGuid();;
-		exportData.properties.push_back(property41);
+		readGuidValue(property41);
+		addProperty(exportData, property41);
 
 		// read entity and guid value
 		UassetData::Export::Property property51;
 		property51.PropertyName = "Exec - Entity";
 		property51.PropertyType = "int";
-		property51.intValue = readInt32();;
+		readIntValue(property51);
 		//	exportData.properties.push_back(property5);
 		property51.PropertyName = "Exec - Entity Guid";
 		property51.PropertyType = "FString";
-		property51.stringValue = readGuid();;
+		readGuidValue(property51);
 		//	exportData.properties.push_back(property5);
 
 	}
@@ -3486,24 +4910,23 @@ void Uasset::processexecute(UassetData::Export& exportData, size_t& exportDataId
 	int32_t val1 = readInt32(); // PinFriendlyName
 	int32_t val2 = readInt32(); // PinFriendlyName
 	int8_t val3 = readByte(); // PinFriendlyName
-	int32_t  val4 = readInt32(); // Source index
-	std::string strVal = readFString();  //PinToolTip
-	int32_t  val5 = readByte(); // Direction
 	UassetData::Export::Property property;
 	property.PropertyName = "Execute -Source index ";
 	property.PropertyType = "int";
-	property.intValue = val4;
-	exportData.properties.push_back(property);
+	readIntValue(property); // Source index
+	std::string strVal = readFString();  //PinToolTip
+	int32_t  val5 = readByte(); // Direction
+	addProperty(exportData, property);
 	UassetData::Export::Property property2;
 	property2.PropertyName = "Execute -PinToolTip ";
 	property2.PropertyType = "FString";
 	property2.stringValue = strVal;
-	exportData.properties.push_back(property2);
+	addProperty(exportData, property2);
 	UassetData::Export::Property property3;
 	property3.PropertyName = "Execute -Direction ";
 	property3.PropertyType = "int";
 	property3.intValue = val5;
-	exportData.properties.push_back(property3);
+	addProperty(exportData, property3);
 
 }
 
@@ -3519,7 +4942,7 @@ void Uasset::processWorldContextObject(UassetData::Export& exportData, size_t& e
 	property.PropertyName = "WorldContextObject";
 	property.PropertyType = "FString";
 	property.stringValue = strVal;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processRootComponent(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -3536,9 +4959,9 @@ void Uasset::processRootComponent(UassetData::Export& exportData, size_t& export
 	UassetData::Export::Property property;
 	property.PropertyName = "RootComponent-Value";
 	property.PropertyType = "int";
-	property.intValue = readInt32();
+	readIntValue(property);
 	exportDataIdx += 4;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 
@@ -3547,15 +4970,18 @@ void Uasset::processbAllowDeletion(UassetData::Export& exportData, size_t& expor
 	exportData.metadata.ObjectType = resolveFName(readInt64());
 	readInt64(); // read zeros
 
-	uint8_t flag = readByte();
-	uint8_t val = readByte();
+	size_t flagOffset = currentIdx;
+	uint8_t flag = readByte(); // BoolVal
+	readByte(); // HasPropertyGuid
 
 	UassetData::Export::Property property;
 	property.PropertyName = "bAllowDeletion-Value";
 	property.PropertyType = "bool";
-	property.boolValue = val;
+	property.boolValue = flag != 0;
+	property.valueOffset = static_cast<int64_t>(flagOffset);
+	property.valueSize = 1;
 	exportDataIdx += 4;
-	exportData.properties.push_back(property);
+	addProperty(exportData, property);
 }
 
 void Uasset::processDefault(UassetData::Export& exportData, size_t& exportDataIdx) {
@@ -3567,7 +4993,7 @@ void Uasset::processDefault(UassetData::Export& exportData, size_t& exportDataId
 
 
 float Uasset::readFloat() {
-	if (currentIdx + sizeof(float) > bytesPtr->size()) {
+	if (!canRead(sizeof(float))) {
 		throw ParseException("Out of bounds read (float)");
 	}
 	float val;
@@ -3577,7 +5003,7 @@ float Uasset::readFloat() {
 }
 
 bool Uasset::readBool() {
-	if (currentIdx + sizeof(uint8_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(uint8_t))) {
 		throw ParseException("Out of bounds read (bool)");
 	}
 	uint8_t val = (*bytesPtr)[currentIdx];
@@ -3610,20 +5036,39 @@ void Uasset::readThumbnails() {
 		thumbnail.ImageHeight = readInt32();
 		thumbnail.ImageFormat = "PNG";
 
+		if (thumbnail.ImageHeight == INT32_MIN) {
+			throw ParseException("Invalid thumbnail height");
+		}
 		if (thumbnail.ImageHeight < 0) {
 			thumbnail.ImageFormat = "JPEG";
 			thumbnail.ImageHeight = -thumbnail.ImageHeight;
 		}
 
 		thumbnail.ImageSizeData = readInt32();
-		if (thumbnail.ImageSizeData > 0) {
-			thumbnail.ImageData = readCountBytes(thumbnail.ImageSizeData);
-		}
+		thumbnail.ImageDataOffset = static_cast<int64_t>(currentIdx);
 
 		data.thumbnails.push_back(thumbnail);
 	}
 }
 
+// Copies one thumbnail's image bytes out of the buffer given to parse()
+bool Uasset::loadThumbnail(size_t index) {
+	if (bytesPtr == nullptr || index >= data.thumbnails.size()) {
+		return false;
+	}
+	Thumbnail& thumbnail = data.thumbnails[index];
+	if (thumbnail.ImageSizeData <= 0 || !thumbnail.ImageData.empty()) {
+		return true;
+	}
+	size_t offset = static_cast<size_t>(thumbnail.ImageDataOffset);
+	size_t size = static_cast<size_t>(thumbnail.ImageSizeData);
+	if (offset > bytesPtr->size() || size > bytesPtr->size() - offset) {
+		return false;
+	}
+	thumbnail.ImageData.assign(bytesPtr->begin() + offset, bytesPtr->begin() + offset + size);
+	return true;
+}
+
 void Uasset::readAssetRegistryData() {
 	currentIdx = data.header.AssetRegistryDataOffset;
 
@@ -3632,40 +5077,103 @@ void Uasset::readAssetRegistryData() {
 		nextOffset = data.header.WorldTileInfoDataOffset;
 	}
 
-	data.assetRegistryData.size = nextOffset - data.header.AssetRegistryDataOffset;
+	data.assetRegistryData.size = static_cast<int32_t>(static_cast<int64_t>(nextOffset) - data.header.AssetRegistryDataOffset);
 
 	data.assetRegistryData.DependencyDataOffset = readInt64();
 
+	// Keys are looked up by their bytes in the file; only the first occurrence is copied
+	std::unordered_map<std::string_view, uint32_t> keyIds;
+	auto readKey = [&]() -> uint32_t {
+		size_t start = currentIdx;
+		int32_t length = readInt32();
+		std::string_view view;
+		if (length > 0) {
+			if (static_cast<size_t>(length) > bytesPtr->size() - currentIdx) {
+				throw ParseException("Out of bounds read (FString)");
+			}
+			view = std::string_view(reinterpret_cast<const char*>(bytesPtr->data()) + currentIdx, length - 1);
+			currentIdx += length;
+		}
+		else {
+			// Empty or UTF-16 key: intern the decoded text
+			currentIdx = start;
+			std::string decoded = readFString();
+			auto it = std::find(data.assetRegistryData.Keys.begin(), data.assetRegistryData.Keys.end(), decoded);
+			if (it != data.assetRegistryData.Keys.end()) {
+				return static_cast<uint32_t>(it - data.assetRegistryData.Keys.begin());
+			}
+			data.assetRegistryData.Keys.push_back(decoded);
+			return static_cast<uint32_t>(data.assetRegistryData.Keys.size() - 1);
+		}
+		auto it = keyIds.find(view);
+		if (it != keyIds.end()) {
+			return it->second;
+		}
+		uint32_t id = static_cast<uint32_t>(data.assetRegistryData.Keys.size());
+		data.assetRegistryData.Keys.emplace_back(view);
+		keyIds.emplace(view, id);
+		return id;
+	};
+
 	int32_t count = readInt32();
+	if (count < 0 || static_cast<size_t>(count) > (bytesPtr->size() - currentIdx) / 12) {
+		throw ParseException("Invalid asset registry entry count at " + std::to_string(currentIdx));
+	}
+	data.assetRegistryData.Keys.clear();
 	data.assetRegistryData.data.clear();
-	for (int32_t idx = 0; idx < count; ++idx) {
-		AssetRegistryEntry entry;
+	data.assetRegistryData.data.resize(count);
+	for (AssetRegistryEntry& entry : data.assetRegistryData.data) {
 		entry.ObjectPath = readFString();
 		entry.ObjectClassName = readFString();
 
 		int32_t countTag = readInt32();
-		for (int32_t idxTag = 0; idxTag < countTag; ++idxTag) {
-			Tag tag;
-			tag.Key = readFString();
+		if (countTag < 0 || static_cast<size_t>(countTag) > (bytesPtr->size() - currentIdx) / 8) {
+			throw ParseException("Invalid asset registry tag count at " + std::to_string(currentIdx));
+		}
+		entry.Tags.resize(countTag);
+		for (Tag& tag : entry.Tags) {
+			tag.KeyId = readKey();
 			tag.Value = readFString();
-			entry.Tags.push_back(tag);
 		}
-
-		data.assetRegistryData.data.push_back(entry);
 	}
 }
 
 std::vector<uint8_t> Uasset::readCountBytes(int64_t count) {
-	if (currentIdx + count > bytesPtr->size()) {
-		throw std::runtime_error("Out of bounds read (count bytes)");
+	checkAllocation(count, 1, "byte");
+	if (!canRead(static_cast<uint64_t>(count))) {
+		throw ParseException("Out of bounds read (count bytes)");
 	}
 	std::vector<uint8_t> bytes((*bytesPtr).begin() + currentIdx, (*bytesPtr).begin() + currentIdx + count);
 	currentIdx += count;
 	return bytes;
 }
 
+// Copies count bytes at the cursor into out without moving the cursor
+void Uasset::copyBytes(std::vector<uint8_t>& out, int64_t count) {
+	checkAllocation(count, 1, "byte");
+	if (!canRead(static_cast<uint64_t>(count))) {
+		throw ParseException("Out of bounds read (property bytes)");
+	}
+	out.assign(bytesPtr->begin() + currentIdx, bytesPtr->begin() + currentIdx + count);
+}
+
+// Rejects a count read from the file before anything is sized by it: negative counts, and
+// buffers larger than options.maxAllocationRatio times the input
+void Uasset::checkAllocation(int64_t count, size_t elementSize, const char* what) const {
+	if (count < 0) {
+		throw ParseException(std::string("Negative ") + what + " count " + std::to_string(count));
+	}
+	if (options.maxAllocationRatio == 0) {
+		return;
+	}
+	uint64_t limit = static_cast<uint64_t>(options.maxAllocationRatio) * std::max<uint64_t>(bytesPtr->size(), 4096);
+	if (static_cast<uint64_t>(count) > limit / std::max<size_t>(elementSize, 1)) {
+		throw ParseException(std::string("Allocation budget exceeded by ") + what + " count " + std::to_string(count));
+	}
+}
+
 uint16_t Uasset::readUint16() {
-	if (currentIdx + sizeof(uint16_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(uint16_t))) {
 		throw ParseException("Out of bounds read (uint16)");
 	}
 	uint16_t val;
@@ -3675,7 +5183,7 @@ uint16_t Uasset::readUint16() {
 }
 
 int32_t Uasset::readInt32() {
-	if (currentIdx + sizeof(int32_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(int32_t))) {
 		throw ParseException("Out of bounds read (int32)");
 	}
 	int32_t val;
@@ -3685,7 +5193,7 @@ int32_t Uasset::readInt32() {
 }
 
 uint32_t Uasset::readUint32() {
-	if (currentIdx + sizeof(uint32_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(uint32_t))) {
 		throw ParseException("Out of bounds read (uint32)");
 	}
 	uint32_t val;
@@ -3695,7 +5203,7 @@ uint32_t Uasset::readUint32() {
 }
 
 int64_t Uasset::readInt64() {
-	if (currentIdx + sizeof(int64_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(int64_t))) {
 		throw ParseException("Out of bounds read (int64)");
 	}
 	int64_t val;
@@ -3705,7 +5213,7 @@ int64_t Uasset::readInt64() {
 }
 
 int64_t Uasset::readInt64Export() {
-	if (currentIdx + sizeof(int64_t) > bytesPtr->size()) {
+	if (!canRead(sizeof(int64_t))) {
 		throw std::runtime_error("Out of bounds read (int64)");
 	}
 	uint8_t b0 = (*bytesPtr)[currentIdx];
@@ -3722,29 +5230,36 @@ int64_t Uasset::readInt64Export() {
 }
 
 std::string Uasset::readFString() {
+	std::string str;
+	readFString(str);
+	return str;
+}
+
+// Reads into an existing string, reusing its buffer
+void Uasset::readFString(std::string& out) {
 	int32_t length = readInt32();
-	if (length == 0) return "";
+	out.clear();
+	if (length == 0) return;
 	if (length > 0) {
-		if (currentIdx + length > bytesPtr->size()) {
+		if (!canRead(length)) {
 			throw ParseException("Out of bounds read (FString)");
 		}
-		std::string str((*bytesPtr).begin() + currentIdx, (*bytesPtr).begin() + currentIdx + length - 1);
+		// Assigned from char pointers: an unsigned char iterator range goes through a temporary string
+		out.assign(reinterpret_cast<const char*>(bytesPtr->data() + currentIdx), static_cast<size_t>(length) - 1);
 		currentIdx += length;
-		return str;
 	}
 	else {
-		length = -length * 2;
-		if (currentIdx + length > bytesPtr->size()) {
+		// UTF-16 code units; wchar_t is 4 bytes outside Windows, so they are read one by one
+		size_t units = static_cast<size_t>(-static_cast<int64_t>(length));
+		if (!canRead(units * 2)) {
 			throw ParseException("Out of bounds read (FString)");
 		}
-		std::wstring wstr((wchar_t*)(&(*bytesPtr)[currentIdx]), length / 2 - 1);
-		currentIdx += length;
-		std::string result;
-		result.reserve(wstr.size());
-		for (wchar_t wc : wstr) {
-			result.push_back(static_cast<char>(wc));
+		const uint8_t* text = &(*bytesPtr)[currentIdx];
+		out.reserve(units - 1);
+		for (size_t i = 0; i + 1 < units; ++i) {
+			out.push_back(static_cast<char>(text[2 * i]));
 		}
-		return result;
+		currentIdx += units * 2;
 	}
 }
 
@@ -3759,58 +5274,107 @@ std::string Uasset::readFString() {
 //}
 
 std::string Uasset::readGuid() {
+	std::string text;
+	readGuid(text);
+	return text;
+}
+
+// Formats into out, reusing its capacity
+void Uasset::readGuid(std::string& out) {
 	uint8_t guid[16];
-	if (currentIdx + sizeof(guid) > bytesPtr->size()) {
+	if (!canRead(sizeof(guid))) {
 		throw ParseException("Out of bounds read (Guid)");
 	}
 	std::memcpy(guid, &(*bytesPtr)[currentIdx], sizeof(guid));
 	currentIdx += sizeof(guid);
+	guidBytesToString(guid, out);
+}
 
-	// Convert the GUID to the correct string format with specific reordering
-	std::ostringstream ss;
-	ss << std::hex << std::setfill('0');
-
-	// Correct byte reordering as per your requirement
-	// Desired Output: 27 C4 29 09  46 2F 46 F9  5F 7B 3A 8B 18 35 6D 39
-	ss << std::setw(2) << static_cast<int>(guid[3])  // 27
-		<< std::setw(2) << static_cast<int>(guid[2])  // C4
-		<< std::setw(2) << static_cast<int>(guid[1])  // 29
-		<< std::setw(2) << static_cast<int>(guid[0])  // 09
-		<< '-';
-
-	ss << std::setw(2) << static_cast<int>(guid[7])  // 46
-		<< std::setw(2) << static_cast<int>(guid[6])  // 2F
-		<< '-';
-
-	ss << std::setw(2) << static_cast<int>(guid[5])  // 46
-		<< std::setw(2) << static_cast<int>(guid[4])  // F9
-		<< '-';
-
-	ss << std::setw(2) << static_cast<int>(guid[11])  // 5F
-		<< std::setw(2) << static_cast<int>(guid[10])  // 7B
-		<< '-';
-
-	ss << std::setw(2) << static_cast<int>(guid[9]) // 3A
-		<< std::setw(2) << static_cast<int>(guid[8]) // 8B
-		<< std::setw(2) << static_cast<int>(guid[15]) // 18
-		<< std::setw(2) << static_cast<int>(guid[14]) // 35
-		<< std::setw(2) << static_cast<int>(guid[13]) // 6D
-		<< std::setw(2) << static_cast<int>(guid[12]); // 39
+void Uasset::readIntValue(UassetData::Export::Property& property) {
+	property.valueOffset = static_cast<int64_t>(currentIdx);
+	property.valueSize = sizeof(int32_t);
+	property.intValue = readInt32();
+}
 
-	return ss.str();
+void Uasset::readGuidValue(UassetData::Export::Property& property) {
+	property.valueOffset = static_cast<int64_t>(currentIdx);
+	property.valueSize = 16;
+	readGuid(property.stringValue);
+}
+
+// Reads FEngineVersion: major, minor, patch, changelist and branch name
+std::string Uasset::readEngineVersion() {
+	SpanReader version = readSpan(3 * sizeof(uint16_t) + sizeof(uint32_t));
+	uint16_t major = version.read<uint16_t>();
+	uint16_t minor = version.read<uint16_t>();
+	uint16_t patch = version.read<uint16_t>();
+	uint32_t changelist = version.read<uint32_t>();
+	std::string branch = readFString();
+	return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch) + "-" +
+		std::to_string(changelist) + "+" + branch;
+}
+
+// Bounds-checks a fixed-size block once and returns a cursor over it
+SpanReader Uasset::readSpan(size_t size) {
+	if (size > bytesPtr->size() || currentIdx > bytesPtr->size() - size) {
+		throw ParseException("Out of bounds read (span)");
+	}
+	SpanReader span(bytesPtr->data() + currentIdx, size);
+	currentIdx += size;
+	return span;
 }
 
 
-std::string Uasset::resolveFName(int64_t idx) {
+const std::string& Uasset::resolveFName(int64_t idx) {
+	static const std::string none;
 	if (idx >= 0 && idx < (int64_t)data.names.size()) {
 		return data.names[idx].Name;
 	}
-	return "";
+	return none;
 }
 
-json Uasset::toJson() const {
-	json j;
-	j["header"] = {
+// Display text of an FName: numbered instances such as K2Node_Event_2 store the number plus one
+void Uasset::assignFName(std::string& out, int32_t index, int32_t number) {
+	out = resolveFName(index);
+	if (number > 0) {
+		out.append(1, '_').append(std::to_string(number - 1));
+	}
+}
+
+json Uasset::exportJson(const UassetData::Export& exportData) const {
+	return {
+		{"fullPath", data.objectGraph.fullPath(exportData.internalIndex)},
+		{"className", data.objectGraph.className(exportData.internalIndex)},
+		{"classIndex", exportData.classIndex},
+		{"superIndex", exportData.superIndex},
+		{"templateIndex", exportData.templateIndex},
+		{"outerIndex", exportData.outerIndex},
+		{"objectName", exportData.objectName},
+		{"objectFlags", exportData.objectFlags},
+		{"serialSize", exportData.serialSize},
+		{"serialOffset", exportData.serialOffset},
+		{"bForcedExport", exportData.bForcedExport},
+		{"bNotForClient", exportData.bNotForClient},
+		{"bNotForServer", exportData.bNotForServer},
+		{"packageGuid", exportData.packageGuid},
+		{"bIsInheritedInstance", exportData.bIsInheritedInstance},
+		{"packageFlags", exportData.packageFlags},
+		{"bNotAlwaysLoadedForEditorGame", exportData.bNotAlwaysLoadedForEditorGame},
+		{"bIsAsset", exportData.bIsAsset},
+		{"bGeneratePublicHash", exportData.bGeneratePublicHash},
+		{"firstExportDependency", exportData.firstExportDependency},
+		{"serializationBeforeSerializationDependencies", exportData.serializationBeforeSerializationDependencies},
+		{"createBeforeSerializationDependencies", exportData.createBeforeSerializationDependencies},
+		{"serializationBeforeCreateDependencies", exportData.serializationBeforeCreateDependencies},
+		{"createBeforeCreateDependencies", exportData.createBeforeCreateDependencies},
+		{"scriptSerializationStartOffset", exportData.scriptSerializationStartOffset},
+		{"scriptSerializationEndOffset", exportData.scriptSerializationEndOffset},
+		{"data", exportData.data}
+	};
+}
+
+json Uasset::headerJson() const {
+	return {
 		{"EPackageFileTag", data.header.EPackageFileTag},
 		{"LegacyFileVersion", data.header.LegacyFileVersion},
 		{"LegacyUE3Version", data.header.LegacyUE3Version},
@@ -3859,6 +5423,11 @@ json Uasset::toJson() const {
 		{"DataResourceOffset", data.header.DataResourceOffset},
 		{"EngineChangelist", data.header.EngineChangelist}
 	};
+}
+
+json Uasset::toJson() const {
+	json j;
+	j["header"] = headerJson();
 	j["names"] = json::array();
 	for (const auto& name : data.names) {
 		j["names"].push_back({
@@ -3868,8 +5437,10 @@ json Uasset::toJson() const {
 			});
 	}
 	j["imports"] = json::array();
-	for (const auto & import : data.imports) {
+	for (size_t i = 0; i < data.imports.size(); ++i) {
+		const auto& import = data.imports[i];
 		j["imports"].push_back({
+			{"fullPath", data.objectGraph.fullPath(-static_cast<int32_t>(i) - 1)},
 			{"classPackage", import.classPackage},
 			{"className", import.className},
 			{"outerIndex", import.outerIndex},
@@ -3880,29 +5451,24 @@ json Uasset::toJson() const {
 	}
 	j["exports"] = json::array();
 	for (const auto& exportData : data.exports) {
-		j["exports"].push_back({
-			{"classIndex", exportData.classIndex},
-			{"superIndex", exportData.superIndex},
-			{"templateIndex", exportData.templateIndex},
-			{"outerIndex", exportData.outerIndex},
-			{"objectName", exportData.objectName},
-			{"objectFlags", exportData.objectFlags},
-			{"serialSize", exportData.serialSize},
-			{"serialOffset", exportData.serialOffset},
-			{"bForcedExport", exportData.bForcedExport},
-			{"bNotForClient", exportData.bNotForClient},
-			{"bNotForServer", exportData.bNotForServer},
-			{"packageGuid", exportData.packageGuid},
-			{"packageFlags", exportData.packageFlags},
-			{"bNotAlwaysLoadedForEditorGame", exportData.bNotAlwaysLoadedForEditorGame},
-			{"bIsAsset", exportData.bIsAsset},
-			{"bGeneratePublicHash", exportData.bGeneratePublicHash},
-			{"firstExportDependency", exportData.firstExportDependency},
-			{"serializationBeforeSerializationDependencies", exportData.serializationBeforeSerializationDependencies},
-			{"createBeforeSerializationDependencies", exportData.createBeforeSerializationDependencies},
-			{"serializationBeforeCreateDependencies", exportData.serializationBeforeCreateDependencies},
-			{"createBeforeCreateDependencies", exportData.createBeforeCreateDependencies},
-			{"data", exportData.data}
+		j["exports"].push_back(exportJson(exportData));
+	}
+	j["preloadDependencies"] = data.preloadDependencies;
+	j["softObjectPaths"] = json::array();
+	for (const auto& path : data.softObjectPaths) {
+		j["softObjectPaths"].push_back({
+			{"packageName", path.packageName},
+			{"assetName", path.assetName},
+			{"subPathString", path.subPathString}
+			});
+	}
+	j["softPackageReferences"] = data.softPackageReferences;
+	j["searchableNames"] = json::array();
+	for (const auto& entry : data.searchableNames) {
+		j["searchableNames"].push_back({
+			{"packageIndex", entry.packageIndex},
+			{"fullPath", data.objectGraph.fullPath(entry.packageIndex)},
+			{"names", entry.names}
 			});
 	}
 	j["thumbnails"] = json::array();
@@ -3912,8 +5478,11 @@ json Uasset::toJson() const {
 			{"ImageHeight", thumbnail.ImageHeight},
 			{"ImageFormat", thumbnail.ImageFormat},
 			{"ImageSizeData", thumbnail.ImageSizeData},
-			{"ImageData", thumbnail.ImageData}
+			{"ImageDataOffset", thumbnail.ImageDataOffset}
 			});
+		if (!thumbnail.ImageData.empty()) {
+			j["thumbnails"].back()["ImageData"] = thumbnail.ImageData;
+		}
 	}
 	j["assetRegistryData"] = {
 		{"DependencyDataOffset", data.assetRegistryData.DependencyDataOffset},
@@ -3928,7 +5497,7 @@ json Uasset::toJson() const {
 		};
 		for (const auto& tag : entry.Tags) {
 			entryJson["Tags"].push_back({
-				{"Key", tag.Key},
+				{"Key", data.assetRegistryData.key(tag)},
 				{"Value", tag.Value}
 				});
 		}
@@ -3937,191 +5506,6122 @@ json Uasset::toJson() const {
 	return j;
 }
 
-std::string resolveFNameE(const UassetData& data, int32_t idx) {
-	if (idx >= 0 && idx < data.names.size()) {
-		return data.names[idx].Name;
+void UassetData::ObjectGraph::build(const UassetData& data) {
+	clear();
+
+	// In UE5 the summary's FolderName field holds the package name
+	packagePath = data.header.FolderName;
+	if (packagePath.empty() || packagePath[0] != '/') {
+		packagePath = "";
 	}
-	return "";
-}
 
-// Function to print bytes in rows of 8 and corresponding ASCII characters
-void printBytesAndAscii(const std::vector<unsigned char>& buffer) {
-    const size_t bytesPerRow = 8;
+	// Objects come from the spare pool where possible so their strings keep their capacity
+	auto newObject = [this](std::vector<Object>& objects) -> Object& {
+		if (spare.empty()) {
+			objects.emplace_back();
+		}
+		else {
+			objects.push_back(std::move(spare.back()));
+			spare.pop_back();
+		}
+		return objects.back();
+	};
 
-    for (size_t i = 0; i < buffer.size(); i++) {
-        // Print the byte in hex format
-        std::cout << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(buffer[i]) << " ";
+	imports.reserve(data.imports.size());
+	for (size_t i = 0; i < data.imports.size(); ++i) {
+		Object& object = newObject(imports);
+		object.packageIndex = -static_cast<int32_t>(i) - 1;
+		object.outerIndex = data.imports[i].outerIndex;
+		object.classIndex = 0;
+		object.objectName = data.imports[i].objectName;
+		object.className = data.imports[i].className;
+	}
 
-        // Check if we reached the end of the row
-        if ((i + 1) % bytesPerRow == 0 || i + 1 == buffer.size()) {
-            // Calculate the start index of the current row
-            size_t start = (i / bytesPerRow) * bytesPerRow;
-            size_t end = std::min(buffer.size(), start + bytesPerRow); // Ensure 'end' is within bounds
+	exports.reserve(data.exports.size());
+	for (size_t i = 0; i < data.exports.size(); ++i) {
+		Object& object = newObject(exports);
+		object.packageIndex = static_cast<int32_t>(i) + 1;
+		object.outerIndex = data.exports[i].outerIndex;
+		object.classIndex = data.exports[i].classIndex;
+		object.objectName = data.exports[i].objectName;
+	}
 
-            // Add spacing if the last row is incomplete
-            if (end % bytesPerRow != 0) {
-                std::cout << std::string((bytesPerRow - (end - start)) * 3, ' ');
-            }
+	// Export classes refer to other objects; imports carry their class name directly
+	for (Object& object : exports) {
+		const Object* classObject = find(object.classIndex);
+		object.className = classObject ? classObject->objectName : "Class";
+	}
 
-            // Print ASCII representation for the current row
-            std::cout << " | ";
-            for (size_t j = start; j < end; j++) {
-                char ch = buffer[j];
-                std::cout << (std::isprint(static_cast<unsigned char>(ch)) ? ch : '.'); // Safely cast to prevent signed/unsigned issues
-            }
+	resolvePaths();
 
-            std::cout << std::endl;
-        }
-    }
+	// At most half full, so probes stay short
+	size_t slots = 16;
+	while (slots < (imports.size() + exports.size()) * 2) {
+		slots <<= 1;
+	}
+	pathIndex.assign(slots, PathSlot{ 0, 0 });
+	auto insert = [this](const Object& object) {
+		if (object.fullPath.empty()) {
+			return;
+		}
+		uint32_t hash = static_cast<uint32_t>(std::hash<std::string>()(object.fullPath));
+		for (size_t slot = hash & (pathIndex.size() - 1);; slot = (slot + 1) & (pathIndex.size() - 1)) {
+			if (pathIndex[slot].packageIndex == 0) {
+				pathIndex[slot] = PathSlot{ object.packageIndex, hash };
+				return;
+			}
+			// The first object with a path keeps it
+			if (pathIndex[slot].hash == hash && find(pathIndex[slot].packageIndex)->fullPath == object.fullPath) {
+				return;
+			}
+		}
+	};
+	for (const Object& object : imports) {
+		insert(object);
+	}
+	for (const Object& object : exports) {
+		insert(object);
+	}
 }
 
+// Moves the objects to the spare pool for the next build()
+void UassetData::ObjectGraph::clear() {
+	// Reversed, so build() takes them back in the same order
+	for (auto object = exports.rbegin(); object != exports.rend(); ++object) {
+		spare.push_back(std::move(*object));
+	}
+	for (auto object = imports.rbegin(); object != imports.rend(); ++object) {
+		spare.push_back(std::move(*object));
+	}
+	packagePath.clear();
+	imports.clear();
+	exports.clear();
+	pathIndex.clear();
+}
 
-void printUassetData(const UassetData& data) {
-	std::cout << "Header: " << data.header.EPackageFileTag << std::endl;
-	std::cout << "Number of names: " << data.names.size() << std::endl;
-	std::cout << "Number of imports: " << data.imports.size() << std::endl;
-	std::cout << "Number of exports: " << data.exports.size() << std::endl;
-	for (size_t i = 0; i < data.exports.size(); ++i) {
-		std::cout << "export:[" << i << "]   offset: "
-			<< data.exports.at(i).serialOffset << "  size: "
-			<< data.exports.at(i).serialSize << std::endl;
+// Walks each object's outer chain up to an already resolved object with an explicit stack,
+// then builds the paths from the outermost object inward. Malformed files can chain
+// thousands of outers, which would overflow the call stack of a recursive walk.
+void UassetData::ObjectGraph::resolvePaths() {
+	static const std::string empty;
+	enum : uint8_t { Unresolved, InProgress, Done, TooLong };
+	std::vector<uint8_t> state(imports.size() + exports.size(), Unresolved);
+	auto slotOf = [this](int32_t packageIndex) {
+		return packageIndex < 0 ? static_cast<size_t>(-static_cast<int64_t>(packageIndex)) - 1 : imports.size() + packageIndex - 1;
+	};
+
+	std::vector<int32_t> chain;
+	const size_t objectCount = imports.size() + exports.size();
+	for (size_t n = 0; n < objectCount; ++n) {
+		int32_t packageIndex = n < imports.size() ? -static_cast<int32_t>(n) - 1 : static_cast<int32_t>(n - imports.size()) + 1;
+		chain.clear();
+		for (int32_t index = packageIndex; index != 0 && find(index) && state[slotOf(index)] == Unresolved; index = find(index)->outerIndex) {
+			state[slotOf(index)] = InProgress;
+			chain.push_back(index);
+		}
+
+		for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+			Object& object = *it < 0 ? imports[-*it - 1] : exports[*it - 1];
+			uint8_t& objectState = state[slotOf(*it)];
+			const std::string* outerPath = object.packageIndex > 0 ? &packagePath : &empty;
+			if (object.outerIndex != 0) {
+				const Object* outer = find(object.outerIndex);
+				uint8_t outerState = outer ? state[slotOf(object.outerIndex)] : static_cast<uint8_t>(Done);
+				if (outerState == TooLong) {
+					object.fullPath.clear();
+					objectState = TooLong;
+					continue;
+				}
+				// A cycle back into this chain uses the outer's bare name
+				outerPath = !outer ? &empty : outerState == InProgress ? &outer->objectName : &outer->fullPath;
+			}
+
+			if (outerPath->size() + 1 + object.objectName.size() > MaxPathLength) {
+				object.fullPath.clear();
+				objectState = TooLong;
+				continue;
+			}
+			if (outerPath->empty()) {
+				object.fullPath = object.objectName;
+			}
+			else {
+				object.fullPath.assign(*outerPath).append(1, '.').append(object.objectName);
+			}
+			objectState = Done;
+		}
 	}
+}
 
-	// Print names
-	for (const auto& name : data.names) {
-		std::cout << std::endl;
-		std::cout << "Name: " << name.Name << std::endl;
-		std::cout << "NonCasePreservingHash: " << name.NonCasePreservingHash << std::endl;
-		std::cout << "CasePreservingHash: " << name.CasePreservingHash << std::endl;
+const UassetData::ObjectGraph::Object* UassetData::ObjectGraph::find(int32_t packageIndex) const {
+	if (packageIndex < 0 && static_cast<size_t>(-static_cast<int64_t>(packageIndex)) <= imports.size()) {
+		return &imports[-packageIndex - 1];
 	}
+	if (packageIndex > 0 && static_cast<size_t>(packageIndex) <= exports.size()) {
+		return &exports[packageIndex - 1];
+	}
+	return nullptr;
+}
 
-	// Print imports
-	std::cout << "Imports:" << std::endl;
-	for (size_t i = 0; i < data.imports.size(); ++i) {
-		const auto& importA = data.imports[i];
-		std::cout << "Import #" << (i + 1) << ":" << std::endl;
-		std::cout << "  classPackage: " << importA.classPackage << std::endl;
-		std::cout << "  className: " << importA.className << std::endl;
-		std::cout << "  outerIndex: " << importA.outerIndex << std::endl;
-		std::cout << "  objectName: " << importA.objectName << std::endl;
-		std::cout << "  packageName: " << importA.packageName << std::endl;
-		std::cout << "  bImportOptional: " << importA.bImportOptional << std::endl;
+const UassetData::ObjectGraph::Object* UassetData::ObjectGraph::findByPath(const std::string& path) const {
+	if (pathIndex.empty()) {
+		return nullptr;
+	}
+	uint32_t hash = static_cast<uint32_t>(std::hash<std::string>()(path));
+	for (size_t slot = hash & (pathIndex.size() - 1); pathIndex[slot].packageIndex != 0; slot = (slot + 1) & (pathIndex.size() - 1)) {
+		if (pathIndex[slot].hash == hash) {
+			const Object* object = find(pathIndex[slot].packageIndex);
+			if (object->fullPath == path) {
+				return object;
+			}
+		}
 	}
+	return nullptr;
+}
 
-	// Print exports
-	std::cout << "Exports:" << std::endl;
-	for (size_t i = 0; i < data.exports.size(); ++i) {
-		const auto& exportA = data.exports[i];
-		std::cout << std::dec <<"Export #" << (i + 1) << ":" << std::endl;
-		std::cout << "  classIndex: " << exportA.classIndex << std::endl;
-		std::cout << "  superIndex: " << exportA.superIndex << std::endl;
-		std::cout << "  templateIndex: " << exportA.templateIndex << std::endl;
-		std::cout << "  outerIndex: " << exportA.outerIndex << std::endl;
-		std::cout << "  objectName: " << exportA.objectName << std::endl;
-		std::cout << "  objectFlags: " << exportA.objectFlags << std::endl;
-		std::cout << "  serialSize: " << exportA.serialSize << std::endl;
-		std::cout << "  serialOffset: " << exportA.serialOffset << std::endl;
-		std::cout << "  bForcedExport: " << exportA.bForcedExport << std::endl;
-		std::cout << "  bNotForClient: " << exportA.bNotForClient << std::endl;
-		std::cout << "  bNotForServer: " << exportA.bNotForServer << std::endl;
-		std::cout << "  packageGuid: " << exportA.packageGuid << std::endl;
-		std::cout << "  packageFlags: " << exportA.packageFlags << std::endl;
-		std::cout << "  bNotAlwaysLoadedForEditorGame: " << exportA.bNotAlwaysLoadedForEditorGame << std::endl;
-		std::cout << "  bIsAsset: " << exportA.bIsAsset << std::endl;
-		std::cout << "  bGeneratePublicHash: " << exportA.bGeneratePublicHash << std::endl;
-		std::cout << "  firstExportDependency: " << exportA.firstExportDependency << std::endl;
-		std::cout << "  serializationBeforeSerializationDependencies: " << exportA.serializationBeforeSerializationDependencies << std::endl;
-		std::cout << "  createBeforeSerializationDependencies: " << exportA.createBeforeSerializationDependencies << std::endl;
-		std::cout << "  serializationBeforeCreateDependencies: " << exportA.serializationBeforeCreateDependencies << std::endl;
-		std::cout << "  createBeforeCreateDependencies: " << exportA.createBeforeCreateDependencies << std::endl;
-		for (size_t j = 0; j < exportA.data.size(); ++j) {
-			std::cout << "  data[" << j << "]: " << exportA.data[j] << std::endl;
+const std::string& UassetData::ObjectGraph::fullPath(int32_t packageIndex) const {
+	static const std::string empty;
+	const Object* object = find(packageIndex);
+	return object ? object->fullPath : empty;
+}
+
+const std::string& UassetData::ObjectGraph::className(int32_t packageIndex) const {
+	static const std::string empty;
+	const Object* object = find(packageIndex);
+	return object ? object->className : empty;
+}
+
+void UassetData::NameIndex::build(const std::vector<Name>& names) {
+	auto nonAscii = [](const std::string& text) {
+		return std::any_of(text.begin(), text.end(), [](char c) { return static_cast<uint8_t>(c) >= 0x80; });
+	};
+
+	// Spot-check the stored hashes on the first few ASCII names
+	bool storedHashes = true;
+	size_t sampled = 0;
+	for (size_t i = 0; i < names.size() && sampled < 4 && storedHashes; ++i) {
+		const Name& name = names[i];
+		if (nonAscii(name.Name)) {
+			continue;
 		}
-		// Print nested serial data
-		std::cout << "  Export Serial Data (Chunk):" << std::endl;
+		uint16_t hash, caseHash;
+		computeNameHashes(name.Name, hash, caseHash);
+		storedHashes = hash == name.NonCasePreservingHash && caseHash == name.CasePreservingHash;
+		++sampled;
+	}
 
-		// Interpret the serial data as per the provided structure.
-		if (exportA.chunkData.size() > 0) {
-			const uint8_t* dataPtr = exportA.chunkData.data();
-			std::cout << "    ObjectMetadata:" << std::endl;
-			std::cout << "      ObjectName: " << exportA.metadata.ObjectName << std::endl;
-			std::cout << "      ObjectType: " << exportA.metadata.ObjectType << std::endl;
-//			std::cout << "      OuterObject: " << exportA.metadata.OuterObject << std::endl;
+	// At most half full, so probes stay short
+	uint32_t bits = 4;
+	while ((static_cast<size_t>(1) << bits) < names.size() * 2) {
+		++bits;
+	}
+	shift = 32 - bits;
+	slots.assign(static_cast<size_t>(1) << bits, Slot{ 0, 0, 0 });
+	count = names.size();
+	const size_t mask = slots.size() - 1;
+	for (size_t i = 0; i < names.size(); ++i) {
+		Slot slot{ static_cast<uint32_t>(i) + 1, names[i].NonCasePreservingHash, names[i].CasePreservingHash };
+		if (!storedHashes || nonAscii(names[i].Name)) {
+			computeNameHashes(names[i].Name, slot.hash, slot.caseHash);
+		}
+		size_t position = home(slot.hash);
+		while (slots[position].name != 0) {
+			position = (position + 1) & mask;
+		}
+		slots[position] = slot;
+	}
+}
 
-			std::cout << "    ObjectProperties:" << std::endl;
-			for (size_t j = 0; j < exportA.properties.size(); ++j) {
-			    std::cout << "      Name: " << exportA.properties.at(j).PropertyName << "     ";
-			    std::cout << " (" << exportA.properties.at(j).PropertyType << ") ";
-				if (exportA.properties.at(j).PropertyType == "bool") {
-					std::cout << " " << exportA.properties.at(j).boolValue << " ";
-				}
-				else if (exportA.properties.at(j).PropertyType == "int") {
-					std::cout << " " << exportA.properties.at(j).intValue << " ";
-				}
-				else if (exportA.properties.at(j).PropertyType == "float") {
-					std::cout << " " << exportA.properties.at(j).floatValue << " ";
-				}
-				else if (exportA.properties.at(j).PropertyType == "FString") {
-					std::cout << " " << exportA.properties.at(j).stringValue << " ";
-				}
-				// Print raw bytes in the buffer
-				printBytesAndAscii(exportA.properties.at(j).byteBuffer);
-				std::cout << std::dec << std::endl;
+void UassetData::NameIndex::clear() {
+	slots.clear();
+	count = 0;
+	shift = 32;
+}
+
+// Walks the run of occupied slots from the hash's home slot; names are inserted in index
+// order but can wrap, so the whole run is checked for the lowest match
+template <typename Match>
+int32_t UassetData::NameIndex::probe(const std::vector<Name>& names, uint16_t hash, Match match) const {
+	if (slots.empty()) {
+		return -1;
+	}
+	const size_t mask = slots.size() - 1;
+	int32_t found = -1;
+	for (size_t position = home(hash); slots[position].name != 0; position = (position + 1) & mask) {
+		const Slot& slot = slots[position];
+		size_t index = slot.name - 1;
+		if (slot.hash == hash && index < names.size() && match(slot, names[index].Name)) {
+			if (found < 0 || static_cast<int32_t>(index) < found) {
+				found = static_cast<int32_t>(index);
 			}
 		}
 	}
+	return found;
+}
 
+int32_t UassetData::NameIndex::find(const std::vector<Name>& names, const std::string& text) const {
+	uint16_t hash, caseHash;
+	computeNameHashes(text, hash, caseHash);
+	return probe(names, hash, [&](const Slot& slot, const std::string& name) {
+		return slot.caseHash == caseHash && name == text;
+	});
+}
 
-	// Print thumbnail data
-	for (const auto& thumbnail : data.thumbnails) {
-		std::cout << "Thumbnail:" << std::endl;
-		std::cout << "  Width: " << thumbnail.ImageWidth << std::endl;
-		std::cout << "  Height: " << thumbnail.ImageHeight << std::endl;
-		std::cout << "  Format: " << thumbnail.ImageFormat << std::endl;
-		std::cout << "  Data Size: " << thumbnail.ImageSizeData << std::endl;
-	}
+int32_t UassetData::NameIndex::findIgnoreCase(const std::vector<Name>& names, const std::string& text) const {
+	uint16_t hash, caseHash;
+	computeNameHashes(text, hash, caseHash);
+	auto upper = [](char c) {
+		return c >= 'a' && c <= 'z' ? static_cast<char>(c - ('a' - 'A')) : c;
+	};
+	return probe(names, hash, [&](const Slot&, const std::string& name) {
+		return name.size() == text.size() && std::equal(name.begin(), name.end(), text.begin(), [&](char a, char b) {
+			return upper(a) == upper(b);
+		});
+	});
+}
 
-	// Print asset registry data
-	std::cout << "Asset Registry Data Size: " << data.assetRegistryData.size << std::endl;
-	std::cout << "Dependency Data Offset: " << data.assetRegistryData.DependencyDataOffset << std::endl;
+// The CRCs are serial within a name and table-driven (SSE4.2's crc32 instruction implements a
+// different polynomial), so SSE2 does the rest: the names are packed into one buffer that is
+// upper-cased 16 bytes at a time, and the recomputed hashes are compared with the stored ones
+// four names at a time.
+UassetData::NameIndex::HashCheck UassetData::NameIndex::verifyHashes(const std::vector<Name>& names) {
+	const NameHashTables& tables = NameHashTables::get();
+	HashCheck check;
+
+	std::vector<uint32_t> starts(names.size() + 1, 0);
+	for (size_t i = 0; i < names.size(); ++i) {
+		starts[i + 1] = starts[i] + static_cast<uint32_t>(names[i].Name.size());
+	}
+	std::vector<char> text(starts.back() + 16);
+	for (size_t i = 0; i < names.size(); ++i) {
+		std::memcpy(text.data() + starts[i], names[i].Name.data(), names[i].Name.size());
+	}
+	std::vector<char> upper(text.size());
+	size_t j = 0;
+#ifdef UEPARSER_SSE2
+	const __m128i beforeA = _mm_set1_epi8('a' - 1);
+	const __m128i afterZ = _mm_set1_epi8('z' + 1);
+	const __m128i caseBit = _mm_set1_epi8('a' - 'A');
+	for (; j + 16 <= text.size(); j += 16) {
+		// Signed compares, so bytes >= 0x80 are never taken for lower-case letters
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + j));
+		__m128i lower = _mm_and_si128(_mm_cmpgt_epi8(block, beforeA), _mm_cmplt_epi8(block, afterZ));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(upper.data() + j), _mm_sub_epi8(block, _mm_and_si128(lower, caseBit)));
+	}
+#endif
+	for (; j < text.size(); ++j) {
+		char c = text[j];
+		upper[j] = c >= 'a' && c <= 'z' ? static_cast<char>(c - ('a' - 'A')) : c;
+	}
+
+	// Both hashes packed as NonCasePreservingHash | CasePreservingHash << 16
+	std::vector<uint32_t> stored(names.size());
+	std::vector<uint32_t> computed(names.size());
+	for (size_t i = 0; i < names.size(); ++i) {
+		stored[i] = names[i].NonCasePreservingHash | static_cast<uint32_t>(names[i].CasePreservingHash) << 16;
+		uint32_t nonCase = 0;
+		uint32_t crc = 0xFFFFFFFF;
+		uint8_t highBits = 0;
+		for (uint32_t k = starts[i]; k < starts[i + 1]; ++k) {
+			uint8_t c = static_cast<uint8_t>(text[k]);
+			highBits |= c;
+			tables.step(c, static_cast<uint8_t>(upper[k]), nonCase, crc);
+		}
+		if (highBits & 0x80) {
+			computed[i] = stored[i];
+			++check.skipped;
+			continue;
+		}
+		computed[i] = (nonCase & 0xFFFF) | (~crc & 0xFFFF) << 16;
+		++check.checked;
+	}
 
-	for (const auto& entry : data.assetRegistryData.data) {
-		std::cout << "Object Path: " << entry.ObjectPath << std::endl;
-		std::cout << "Object Class Name: " << entry.ObjectClassName << std::endl;
-		for (const auto& tag : entry.Tags) {
-			std::cout << "  Tag Key: " << tag.Key << ", Tag Value: " << tag.Value << std::endl;
+	size_t i = 0;
+#ifdef UEPARSER_SSE2
+	for (; i + 4 <= names.size(); i += 4) {
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(computed.data() + i));
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stored.data() + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)) == 0xFFFF) {
+			continue;
+		}
+		for (size_t k = i; k < i + 4; ++k) {
+			if (computed[k] != stored[k]) {
+				check.mismatches.push_back(static_cast<uint32_t>(k));
+			}
+		}
+	}
+#endif
+	for (; i < names.size(); ++i) {
+		if (computed[i] != stored[i]) {
+			check.mismatches.push_back(static_cast<uint32_t>(i));
 		}
 	}
+	return check;
 }
 
+// Queries over the columnar import/export tables. Each filter first fills a byte mask
+// in a branch-free loop over one column (which the compiler can vectorize), then
+// compacts the mask into 1-based export numbers or 0-based import slots.
 
+static std::vector<int32_t> compactMask(const std::vector<uint8_t>& mask) {
+	std::vector<int32_t> result;
+	for (size_t i = 0; i < mask.size(); ++i) {
+		if (mask[i]) {
+			result.push_back(static_cast<int32_t>(i) + 1);
+		}
+	}
+	return result;
+}
 
-int main() {
-	//    std::ifstream file("C:/Users/kapis/Downloads/Blueprint/BP_FrontEndPlayerController.uasset", std::ios::binary);
-	  std::ifstream file("C:/Users/kapis/Downloads/Blueprint/BP_SandWorldPlayerController.uasset", std::ios::binary);
-	//    std::ifstream file("C:/Users/kapis/Downloads/Blueprint/BP_SaveGameState.uasset", std::ios::binary);
-	 
+// Returns the name table index of a string, or -1 if the package does not contain it. Uses the
+// hash index unless names were added after parsing.
+int32_t findNameIndex(const UassetData& data, const std::string& name) {
+	if (data.nameIndex.size() == data.names.size()) {
+		return data.nameIndex.find(data.names, name);
+	}
+	for (size_t i = 0; i < data.names.size(); ++i) {
+		if (data.names[i].Name == name) {
+			return static_cast<int32_t>(i);
+		}
+	}
+	return -1;
+}
 
-	if (!file) {
-		std::cerr << "Failed to open file" << std::endl;
-		return 1;
+// Same, comparing like FNames do: ASCII letters match regardless of case
+int32_t findNameIndexIgnoreCase(const UassetData& data, const std::string& name) {
+	if (data.nameIndex.size() == data.names.size()) {
+		return data.nameIndex.findIgnoreCase(data.names, name);
 	}
-	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	auto upper = [](char c) {
+		return c >= 'a' && c <= 'z' ? static_cast<char>(c - ('a' - 'A')) : c;
+	};
+	for (size_t i = 0; i < data.names.size(); ++i) {
+		const std::string& entry = data.names[i].Name;
+		if (entry.size() == name.size() && std::equal(entry.begin(), entry.end(), name.begin(), [&](char a, char b) { return upper(a) == upper(b); })) {
+			return static_cast<int32_t>(i);
+		}
+	}
+	return -1;
+}
 
-	Uasset uasset;
-	if (!uasset.parse(bytes)) {
-		std::cerr << "Failed to parse uasset file" << std::endl;
-		return 1;
+// Package indices (negative) of all imports with the given object name
+std::vector<int32_t> findImportsByObjectName(const UassetData& data, const std::string& objectName) {
+	std::vector<int32_t> result;
+	int32_t nameIdx = findNameIndex(data, objectName);
+	if (nameIdx < 0) {
+		return result;
 	}
+	const std::vector<int32_t>& column = data.importMap.objectNameIndex;
+	std::vector<uint8_t> mask(column.size());
+	for (size_t i = 0; i < column.size(); ++i) {
+		mask[i] = column[i] == nameIdx;
+	}
+	result = compactMask(mask);
+	for (int32_t& idx : result) {
+		idx = -idx;
+	}
+	return result;
+}
 
-	// Print parsed data
-	printUassetData(uasset.data);
+// Export numbers (1-based) whose ClassIndex equals the given package index
+std::vector<int32_t> filterExportsByClass(const UassetData::ExportMap& map, int32_t classIndex) {
+	const std::vector<int32_t>& column = map.classIndex;
+	std::vector<uint8_t> mask(column.size());
+	for (size_t i = 0; i < column.size(); ++i) {
+		mask[i] = column[i] == classIndex;
+	}
+	return compactMask(mask);
+}
 
-	// Convert to JSON
-	json j = uasset.toJson();
-	std::cout << j.dump(4) << std::endl;
+// Export numbers whose OuterIndex equals the given package index
+std::vector<int32_t> filterExportsByOuter(const UassetData::ExportMap& map, int32_t outerIndex) {
+	const std::vector<int32_t>& column = map.outerIndex;
+	std::vector<uint8_t> mask(column.size());
+	for (size_t i = 0; i < column.size(); ++i) {
+		mask[i] = column[i] == outerIndex;
+	}
+	return compactMask(mask);
+}
 
-	return 0;
+// Export numbers with all bits of flagMask set in ObjectFlags
+std::vector<int32_t> filterExportsByFlags(const UassetData::ExportMap& map, uint32_t flagMask) {
+	const std::vector<uint32_t>& column = map.objectFlags;
+	std::vector<uint8_t> mask(column.size());
+	for (size_t i = 0; i < column.size(); ++i) {
+		mask[i] = (column[i] & flagMask) == flagMask;
+	}
+	return compactMask(mask);
+}
+
+// Export numbers with SerialSize >= minSize
+std::vector<int32_t> filterExportsBySerialSize(const UassetData::ExportMap& map, int64_t minSize) {
+	const std::vector<int64_t>& column = map.serialSize;
+	std::vector<uint8_t> mask(column.size());
+	for (size_t i = 0; i < column.size(); ++i) {
+		mask[i] = column[i] >= minSize;
+	}
+	return compactMask(mask);
 }
 
+// Export numbers whose class is the import with the given object name (e.g. "K2Node_Event")
+std::vector<int32_t> filterExportsByClassName(const UassetData& data, const std::string& className) {
+	std::vector<int32_t> result;
+	for (int32_t importIdx : findImportsByObjectName(data, className)) {
+		std::vector<int32_t> matches = filterExportsByClass(data.exportMap, importIdx);
+		result.insert(result.end(), matches.begin(), matches.end());
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
 
+// Export columns of many packages concatenated into one table. Class names are
+// interned project-wide so a filter is one integer compare per row.
+struct ProjectExportTable {
+	std::vector<uint32_t> packageId;
+	std::vector<int32_t> exportIndex;
+	std::vector<uint32_t> classNameId;
+	std::vector<int32_t> outerIndex;
+	std::vector<uint32_t> objectFlags;
+	std::vector<int64_t> serialSize;
+	std::vector<int64_t> serialOffset;
+
+	std::vector<std::string> classNames;
+	std::unordered_map<std::string, uint32_t> classNameIds;
+
+	size_t size() const { return packageId.size(); }
+
+	uint32_t internClassName(const std::string& name) {
+		auto it = classNameIds.find(name);
+		if (it != classNameIds.end()) {
+			return it->second;
+		}
+		uint32_t id = static_cast<uint32_t>(classNames.size());
+		classNames.push_back(name);
+		classNameIds.emplace(name, id);
+		return id;
+	}
+
+	void append(uint32_t package, const UassetData& data) {
+		const UassetData::ExportMap& map = data.exportMap;
+
+		// Resolve each distinct class index of this package once
+		std::unordered_map<int32_t, uint32_t> classIds;
+		for (size_t i = 0; i < map.size(); ++i) {
+			int32_t classIdx = map.classIndex[i];
+			auto it = classIds.find(classIdx);
+			if (it == classIds.end()) {
+				std::string name;
+				if (classIdx < 0 && static_cast<size_t>(-static_cast<int64_t>(classIdx)) <= data.imports.size()) {
+					name = data.imports[-classIdx - 1].objectName;
+				}
+				else if (classIdx > 0 && static_cast<size_t>(classIdx) <= data.exports.size()) {
+					name = data.exports[classIdx - 1].objectName;
+				}
+				it = classIds.emplace(classIdx, internClassName(name)).first;
+			}
+			packageId.push_back(package);
+			exportIndex.push_back(static_cast<int32_t>(i) + 1);
+			classNameId.push_back(it->second);
+			outerIndex.push_back(map.outerIndex[i]);
+			objectFlags.push_back(map.objectFlags[i]);
+			serialSize.push_back(map.serialSize[i]);
+			serialOffset.push_back(map.serialOffset[i]);
+		}
+	}
+
+	// Row numbers of all exports whose class has the given name
+	std::vector<size_t> rowsWithClass(const std::string& className) const {
+		std::vector<size_t> rows;
+		auto it = classNameIds.find(className);
+		if (it == classNameIds.end()) {
+			return rows;
+		}
+		const uint32_t id = it->second;
+		std::vector<uint8_t> mask(classNameId.size());
+		for (size_t i = 0; i < classNameId.size(); ++i) {
+			mask[i] = classNameId[i] == id;
+		}
+		for (size_t i = 0; i < mask.size(); ++i) {
+			if (mask[i]) {
+				rows.push_back(i);
+			}
+		}
+		return rows;
+	}
+};
+
+// Export load-order DAG of one package built from the preload dependency array.
+// Node 2*i is "create export i", node 2*i+1 is "serialize export i"; an edge a->b
+// means a must finish before b can start. Import dependencies are resolved before
+// the package starts loading, so they are counted but add no edges.
+struct LoadOrderReport {
+	struct Bottleneck {
+		int32_t exportIndex;      // 1-based package index
+		uint32_t blockedSteps;    // steps that wait directly on this serialization
+		uint32_t depth;
+		int64_t serialSize;
+	};
+
+	size_t stepCount = 0;
+	size_t edgeCount = 0;
+	size_t importDependencies = 0;
+	size_t invalidDependencies = 0;
+	bool hasCycle = false;
+	uint32_t criticalPathDepth = 0;   // longest chain of create/serialize steps
+	int64_t criticalPathBytes = 0;    // export bytes serialized along that chain
+	uint32_t maxParallelSteps = 0;    // widest dependency level
+	std::vector<uint32_t> criticalPath;
+	std::vector<Bottleneck> bottlenecks;
+
+	static int32_t exportOfStep(uint32_t step) { return static_cast<int32_t>(step / 2) + 1; }
+	static bool isSerializeStep(uint32_t step) { return (step & 1) != 0; }
+};
+
+LoadOrderReport simulateLoadOrder(const UassetData& data, size_t maxBottlenecks = 10) {
+	LoadOrderReport report;
+	const UassetData::ExportMap& map = data.exportMap;
+	const std::vector<int32_t>& deps = data.preloadDependencies;
+	const uint32_t exportCount = static_cast<uint32_t>(map.size());
+	const uint32_t steps = exportCount * 2;
+	report.stepCount = steps;
+
+	std::vector<std::pair<uint32_t, uint32_t>> edges;
+	auto addDependencies = [&](uint32_t exportIdx, int32_t first, int32_t count, bool fromSerialize, bool toSerialize) {
+		for (int32_t k = 0; k < count; ++k) {
+			int32_t dep = deps[first + k];
+			if (dep < 0) {
+				++report.importDependencies;
+			}
+			else if (dep == 0 || static_cast<uint32_t>(dep) > exportCount) {
+				++report.invalidDependencies;
+			}
+			else {
+				uint32_t from = (static_cast<uint32_t>(dep) - 1) * 2 + (fromSerialize ? 1 : 0);
+				uint32_t to = exportIdx * 2 + (toSerialize ? 1 : 0);
+				edges.push_back({ from, to });
+			}
+		}
+	};
+
+	for (uint32_t i = 0; i < exportCount; ++i) {
+		edges.push_back({ i * 2, i * 2 + 1 }); // an export is created before it is serialized
+
+		int32_t first = map.firstExportDependency[i];
+		int32_t sbs = map.serializationBeforeSerializationDependencies[i];
+		int32_t cbs = map.createBeforeSerializationDependencies[i];
+		int32_t sbc = map.serializationBeforeCreateDependencies[i];
+		int32_t cbc = map.createBeforeCreateDependencies[i];
+		if (first < 0) {
+			continue;
+		}
+		int64_t total = static_cast<int64_t>(sbs) + cbs + sbc + cbc;
+		if (sbs < 0 || cbs < 0 || sbc < 0 || cbc < 0 || first + total > static_cast<int64_t>(deps.size())) {
+			++report.invalidDependencies;
+			continue;
+		}
+		// The four lists are stored back to back in this order
+		addDependencies(i, first, sbs, true, true);
+		addDependencies(i, first + sbs, cbs, false, true);
+		addDependencies(i, first + sbs + cbs, sbc, true, false);
+		addDependencies(i, first + sbs + cbs + sbc, cbc, false, false);
+	}
+	report.edgeCount = edges.size();
+
+	// Successor lists in CSR form
+	std::vector<uint32_t> offsets(steps + 1, 0);
+	std::vector<uint32_t> successors(edges.size());
+	std::vector<uint32_t> inDegree(steps, 0);
+	for (const auto& edge : edges) {
+		++offsets[edge.first + 1];
+		++inDegree[edge.second];
+	}
+	for (uint32_t n = 0; n < steps; ++n) {
+		offsets[n + 1] += offsets[n];
+	}
+	std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+	for (const auto& edge : edges) {
+		successors[fill[edge.first]++] = edge.second;
+	}
+
+	// Kahn's algorithm; depth is the length of the longest chain ending at a step
+	std::vector<uint32_t> order;
+	order.reserve(steps);
+	std::vector<uint32_t> depth(steps, 1);
+	std::vector<uint32_t> longestPred(steps, UINT32_MAX);
+	for (uint32_t n = 0; n < steps; ++n) {
+		if (inDegree[n] == 0) {
+			order.push_back(n);
+		}
+	}
+	for (size_t head = 0; head < order.size(); ++head) {
+		uint32_t node = order[head];
+		for (uint32_t e = offsets[node]; e < offsets[node + 1]; ++e) {
+			uint32_t next = successors[e];
+			if (depth[node] + 1 > depth[next]) {
+				depth[next] = depth[node] + 1;
+				longestPred[next] = node;
+			}
+			if (--inDegree[next] == 0) {
+				order.push_back(next);
+			}
+		}
+	}
+	report.hasCycle = order.size() != steps;
+	if (order.empty()) {
+		return report;
+	}
+
+	// Height is the length of the longest chain starting at a step
+	std::vector<uint32_t> height(steps, 1);
+	for (size_t k = order.size(); k-- > 0;) {
+		uint32_t node = order[k];
+		for (uint32_t e = offsets[node]; e < offsets[node + 1]; ++e) {
+			height[node] = std::max(height[node], height[successors[e]] + 1);
+		}
+	}
+
+	uint32_t tail = order[0];
+	std::vector<uint32_t> levelWidth;
+	for (uint32_t node : order) {
+		if (depth[node] > depth[tail]) {
+			tail = node;
+		}
+		if (levelWidth.size() < depth[node]) {
+			levelWidth.resize(depth[node], 0);
+		}
+		++levelWidth[depth[node] - 1];
+	}
+	report.criticalPathDepth = depth[tail];
+	report.maxParallelSteps = *std::max_element(levelWidth.begin(), levelWidth.end());
+	for (uint32_t node = tail; node != UINT32_MAX; node = longestPred[node]) {
+		report.criticalPath.push_back(node);
+		if (LoadOrderReport::isSerializeStep(node)) {
+			report.criticalPathBytes += map.serialSize[node / 2];
+		}
+	}
+	std::reverse(report.criticalPath.begin(), report.criticalPath.end());
+
+	// Bottlenecks: serializations on a longest chain (no slack), ranked by how many steps wait on them
+	for (uint32_t node : order) {
+		if (!LoadOrderReport::isSerializeStep(node) || depth[node] + height[node] - 1 != report.criticalPathDepth) {
+			continue;
+		}
+		uint32_t blocked = offsets[node + 1] - offsets[node];
+		if (blocked == 0) {
+			continue;
+		}
+		report.bottlenecks.push_back({ LoadOrderReport::exportOfStep(node), blocked, depth[node], map.serialSize[node / 2] });
+	}
+	std::sort(report.bottlenecks.begin(), report.bottlenecks.end(), [](const LoadOrderReport::Bottleneck& a, const LoadOrderReport::Bottleneck& b) {
+		return a.blockedSteps != b.blockedSteps ? a.blockedSteps > b.blockedSteps : a.serialSize > b.serialSize;
+	});
+	if (report.bottlenecks.size() > maxBottlenecks) {
+		report.bottlenecks.resize(maxBottlenecks);
+	}
+	return report;
+}
+
+// Writes UassetData back to package bytes. The file is treated as a sequence of regions
+// (summary, header sections, export bodies, trailing bulk data) that are emitted in their
+// original order: the name table is re-encoded, modified export bodies come from chunkData,
+// everything else is copied from the source bytes. Offsets in the summary, export map,
+// thumbnail table and asset registry are then relocated to the new layout. Absolute offsets
+// stored inside export bodies or data resources are not rewritten. Exports, imports and the
+// summary's own strings cannot be added or resized; renaming or adding names and growing
+// export bodies can.
+class UassetWriter {
+public:
+	UassetWriter(const UassetData& data, const std::vector<uint8_t>& source) : data_(data), source_(source) {}
+
+	// Throws ParseException if the data no longer matches the source layout
+	std::vector<uint8_t> write();
+
+private:
+	enum RegionKind : uint8_t { Copy, Summary, Names, ExportTable, ThumbnailTable, AssetRegistry, Body };
+
+	struct Region {
+		size_t oldStart;
+		size_t oldEnd;
+		RegionKind kind;
+		size_t exportIdx;
+		size_t newStart;
+		size_t newEnd;
+	};
+
+	void collectRegions();
+	void writeNames(const Region& region);
+	void patchExportTable(const Region& region);
+	void patchThumbnailTable(const Region& region);
+	void patchSummary();
+	int64_t relocate(int64_t oldOffset) const;
+
+	template <typename T>
+	void patch(size_t position, T value) {
+		std::memcpy(out_.data() + position, &value, sizeof(T));
+	}
+	void append(size_t start, size_t end) {
+		out_.insert(out_.end(), source_.begin() + start, source_.begin() + end);
+	}
+
+	const UassetData& data_;
+	const std::vector<uint8_t>& source_;
+	std::vector<Region> regions_;
+	std::vector<uint8_t> out_;
+};
+
+// Length-prefixed string as the reader decodes it: ANSI with a terminator, or UTF-16 when negative
+static void appendFString(std::vector<uint8_t>& out, const std::string& text) {
+	if (text.empty()) {
+		out.insert(out.end(), 4, 0);
+		return;
+	}
+	bool ansi = std::all_of(text.begin(), text.end(), [](char c) { return static_cast<uint8_t>(c) < 0x80; });
+	if (ansi) {
+		int32_t length = static_cast<int32_t>(text.size()) + 1;
+		out.insert(out.end(), reinterpret_cast<const uint8_t*>(&length), reinterpret_cast<const uint8_t*>(&length) + 4);
+		out.insert(out.end(), text.begin(), text.end());
+		out.push_back(0);
+		return;
+	}
+
+	// Anything else is taken as UTF-8 and saved as UTF-16 code units
+	std::vector<uint16_t> units;
+	for (size_t i = 0; i < text.size();) {
+		uint8_t lead = static_cast<uint8_t>(text[i]);
+		size_t extra = lead < 0x80 ? 0 : (lead & 0xE0) == 0xC0 ? 1 : (lead & 0xF0) == 0xE0 ? 2 : (lead & 0xF8) == 0xF0 ? 3 : 4;
+		if (extra > 3 || i + extra >= text.size()) {
+			throw ParseException("Name is not valid UTF-8: " + text);
+		}
+		uint32_t codePoint = extra == 0 ? lead : lead & (0x3F >> extra);
+		for (size_t k = 1; k <= extra; ++k) {
+			uint8_t next = static_cast<uint8_t>(text[i + k]);
+			if ((next & 0xC0) != 0x80) {
+				throw ParseException("Name is not valid UTF-8: " + text);
+			}
+			codePoint = codePoint << 6 | (next & 0x3F);
+		}
+		static const uint32_t minimum[] = { 0, 0x80, 0x800, 0x10000 };
+		if (codePoint < minimum[extra] || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint == 0) {
+			throw ParseException("Name is not valid UTF-8: " + text);
+		}
+		if (codePoint >= 0x10000) {
+			units.push_back(static_cast<uint16_t>(0xD800 + ((codePoint - 0x10000) >> 10)));
+			units.push_back(static_cast<uint16_t>(0xDC00 + ((codePoint - 0x10000) & 0x3FF)));
+		}
+		else {
+			units.push_back(static_cast<uint16_t>(codePoint));
+		}
+		i += extra + 1;
+	}
+	int32_t prefix = -(static_cast<int32_t>(units.size()) + 1);
+	out.insert(out.end(), reinterpret_cast<const uint8_t*>(&prefix), reinterpret_cast<const uint8_t*>(&prefix) + 4);
+	for (uint16_t unit : units) {
+		out.push_back(static_cast<uint8_t>(unit));
+		out.push_back(static_cast<uint8_t>(unit >> 8));
+	}
+	out.insert(out.end(), 2, 0);
+}
+
+// Size of the FString at offset and whether it decodes (as Uasset::readFString does) to text
+static size_t compareFString(const std::vector<uint8_t>& bytes, size_t offset, const std::string& text, bool& equal) {
+	equal = false;
+	int32_t length;
+	if (offset + 4 > bytes.size()) {
+		return 0;
+	}
+	std::memcpy(&length, bytes.data() + offset, 4);
+	size_t units = static_cast<size_t>(length < 0 ? -static_cast<int64_t>(length) : length);
+	size_t size = 4 + units * (length < 0 ? 2 : 1);
+	if (size > bytes.size() - offset) {
+		return 0;
+	}
+	if (units == 0) {
+		equal = text.empty();
+		return size;
+	}
+	if (text.size() != units - 1) {
+		return size;
+	}
+	for (size_t i = 0; i + 1 < units; ++i) {
+		char c = length > 0 ? static_cast<char>(bytes[offset + 4 + i]) : static_cast<char>(bytes[offset + 4 + i * 2]);
+		if (c != text[i]) {
+			return size;
+		}
+	}
+	equal = true;
+	return size;
+}
+
+void UassetWriter::collectRegions() {
+	const UassetData::Header& header = data_.header;
+	const UassetData::SummaryLayout& layout = data_.summaryLayout;
+	const size_t headerEnd = static_cast<size_t>(header.TotalHeaderSize);
+	if (layout.end == 0 || headerEnd < layout.end || headerEnd > source_.size()) {
+		throw ParseException("Summary does not match the source bytes");
+	}
+
+	// Header sections, keyed by start offset. When two sections share an offset one of
+	// them is empty, so the kind that needs fix-ups wins.
+	std::vector<std::pair<size_t, RegionKind>> starts;
+	auto addSection = [&](int64_t offset, RegionKind kind) {
+		if (offset >= static_cast<int64_t>(layout.end) && offset < static_cast<int64_t>(headerEnd)) {
+			starts.push_back({ static_cast<size_t>(offset), kind });
+		}
+	};
+	addSection(header.NameOffset, Names);
+	addSection(header.SoftObjectPathsOffset, Copy);
+	addSection(header.GatherableTextDataOffset, Copy);
+	addSection(header.ImportOffset, Copy);
+	addSection(header.ExportOffset, ExportTable);
+	addSection(header.DependsOffset, Copy);
+	addSection(header.SoftPackageReferencesOffset, Copy);
+	addSection(header.SearchableNamesOffset, Copy);
+	addSection(header.ThumbnailTableOffset, ThumbnailTable);
+	addSection(header.AssetRegistryDataOffset, AssetRegistry);
+	addSection(header.WorldTileInfoDataOffset, Copy);
+	addSection(header.PreloadDependencyOffset, Copy);
+	addSection(header.DataResourceOffset, Copy);
+	std::sort(starts.begin(), starts.end(), [](const std::pair<size_t, RegionKind>& a, const std::pair<size_t, RegionKind>& b) {
+		return a.first != b.first ? a.first < b.first : a.second > b.second;
+	});
+	starts.erase(std::unique(starts.begin(), starts.end(), [](const std::pair<size_t, RegionKind>& a, const std::pair<size_t, RegionKind>& b) {
+		return a.first == b.first;
+	}), starts.end());
+
+	auto addRegion = [&](size_t start, size_t end, RegionKind kind, size_t exportIdx) {
+		if (end > start) {
+			regions_.push_back({ start, end, kind, exportIdx, 0, 0 });
+		}
+	};
+	addRegion(0, layout.end, Summary, 0);
+	addRegion(layout.end, starts.empty() ? headerEnd : starts[0].first, Copy, 0);
+	for (size_t i = 0; i < starts.size(); ++i) {
+		addRegion(starts[i].first, i + 1 < starts.size() ? starts[i + 1].first : headerEnd, starts[i].second, 0);
+	}
+
+	// Export bodies in file order, with any padding between them kept as copied regions
+	const UassetData::ExportMap& map = data_.exportMap;
+	std::vector<size_t> order;
+	for (size_t i = 0; i < map.size(); ++i) {
+		if (map.serialSize[i] > 0) {
+			order.push_back(i);
+		}
+	}
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return map.serialOffset[a] < map.serialOffset[b]; });
+	size_t position = headerEnd;
+	for (size_t i : order) {
+		size_t start = static_cast<size_t>(map.serialOffset[i]);
+		size_t end = start + static_cast<size_t>(map.serialSize[i]);
+		if (start < position || end > source_.size()) {
+			throw ParseException("Export " + std::to_string(i + 1) + " overlaps another region");
+		}
+		addRegion(position, start, Copy, 0);
+		addRegion(start, end, Body, i);
+		position = end;
+	}
+	addRegion(position, source_.size(), Copy, 0);
+}
+
+void UassetWriter::writeNames(const Region& region) {
+	// Unchanged entries are copied with their stored hashes; new or renamed ones are encoded
+	size_t cursor = region.oldStart;
+	const size_t originalCount = static_cast<size_t>(std::max(data_.header.NameCount, 0));
+	for (size_t i = 0; i < data_.names.size(); ++i) {
+		const UassetData::Name& name = data_.names[i];
+		if (i < originalCount) {
+			bool equal;
+			size_t size = compareFString(source_, cursor, name.Name, equal) + 2 * sizeof(uint16_t);
+			if (size == 2 * sizeof(uint16_t) || cursor + size > region.oldEnd) {
+				throw ParseException("Name table does not match the source bytes");
+			}
+			if (equal) {
+				append(cursor, cursor + size);
+				cursor += size;
+				continue;
+			}
+			cursor += size;
+		}
+		appendFString(out_, name.Name);
+		uint16_t hashes[2] = { name.NonCasePreservingHash, name.CasePreservingHash };
+		out_.insert(out_.end(), reinterpret_cast<const uint8_t*>(hashes), reinterpret_cast<const uint8_t*>(hashes) + sizeof(hashes));
+	}
+	// Bytes between the last name and the next section
+	size_t namesEnd = std::max(data_.summaryLayout.namesEnd, cursor);
+	if (namesEnd < region.oldEnd) {
+		append(namesEnd, region.oldEnd);
+	}
+}
+
+std::vector<uint8_t> UassetWriter::write() {
+	if (data_.exportMap.size() != static_cast<size_t>(std::max(data_.header.ExportCount, 0)) || data_.exports.size() != data_.exportMap.size()) {
+		throw ParseException("Adding or removing exports is not supported");
+	}
+	if (data_.names.size() < static_cast<size_t>(std::max(data_.header.NameCount, 0))) {
+		throw ParseException("Removing names is not supported");
+	}
+	collectRegions();
+
+	out_.clear();
+	out_.reserve(source_.size());
+	for (Region& region : regions_) {
+		region.newStart = out_.size();
+		if (region.kind == Names) {
+			writeNames(region);
+		}
+		else if (region.kind == Body && data_.exports[region.exportIdx].bodyModified) {
+			const std::vector<uint8_t>& body = data_.exports[region.exportIdx].chunkData;
+			out_.insert(out_.end(), body.begin(), body.end());
+		}
+		else {
+			append(region.oldStart, region.oldEnd);
+		}
+		region.newEnd = out_.size();
+	}
+
+	for (const Region& region : regions_) {
+		if (region.kind == ExportTable) {
+			patchExportTable(region);
+		}
+		else if (region.kind == ThumbnailTable) {
+			patchThumbnailTable(region);
+		}
+		else if (region.kind == AssetRegistry && region.oldEnd - region.oldStart >= sizeof(int64_t)) {
+			int64_t dependencyDataOffset;
+			std::memcpy(&dependencyDataOffset, out_.data() + region.newStart, sizeof(int64_t));
+			patch<int64_t>(region.newStart, relocate(dependencyDataOffset));
+		}
+	}
+	patchSummary();
+	return std::move(out_);
+}
+
+// Maps an offset in the source to the same place in the output. Offsets into a re-encoded
+// region are clamped to its new size; 0 and negative values are sentinels and kept.
+int64_t UassetWriter::relocate(int64_t oldOffset) const {
+	if (oldOffset <= 0) {
+		return oldOffset;
+	}
+	size_t offset = static_cast<size_t>(oldOffset);
+	if (offset >= source_.size()) {
+		return static_cast<int64_t>(out_.size() + (offset - source_.size()));
+	}
+	auto it = std::upper_bound(regions_.begin(), regions_.end(), offset, [](size_t value, const Region& region) {
+		return value < region.oldEnd;
+	});
+	if (it == regions_.end()) {
+		return oldOffset;
+	}
+	return static_cast<int64_t>(it->newStart + std::min(offset - it->oldStart, it->newEnd - it->newStart));
+}
+
+void UassetWriter::patchExportTable(const Region& region) {
+	const ExportRecordLayout layout = computeExportRecordLayout(data_.header);
+	const UassetData::ExportMap& map = data_.exportMap;
+	std::vector<int64_t> newOffsets(map.size());
+	std::vector<int64_t> newSizes(map.size());
+	for (size_t i = 0; i < map.size(); ++i) {
+		newOffsets[i] = relocate(map.serialOffset[i]);
+		newSizes[i] = map.serialSize[i];
+	}
+	for (const Region& body : regions_) {
+		if (body.kind == Body) {
+			newOffsets[body.exportIdx] = static_cast<int64_t>(body.newStart);
+			newSizes[body.exportIdx] = static_cast<int64_t>(body.newEnd - body.newStart);
+		}
+	}
+
+	if (map.size() * layout.recordSize > region.newEnd - region.newStart) {
+		throw ParseException("Export table does not match the source bytes");
+	}
+	for (size_t i = 0; i < map.size(); ++i) {
+		size_t position = region.newStart + i * layout.recordSize + layout.serialFieldsOffset;
+		if (layout.hasInt64SerialFields) {
+			patch<int64_t>(position, newSizes[i]);
+			patch<int64_t>(position + sizeof(int64_t), newOffsets[i]);
+		}
+		else {
+			patch<int32_t>(position, static_cast<int32_t>(newSizes[i]));
+			patch<int32_t>(position + sizeof(int32_t), static_cast<int32_t>(newOffsets[i]));
+		}
+	}
+}
+
+void UassetWriter::patchThumbnailTable(const Region& region) {
+	// count, then per entry: class name, object path, image offset
+	size_t position = region.newStart;
+	auto readInt = [&](size_t at) {
+		if (at + sizeof(int32_t) > region.newEnd) {
+			throw ParseException("Thumbnail table does not match the source bytes");
+		}
+		int32_t value;
+		std::memcpy(&value, out_.data() + at, sizeof(value));
+		return value;
+	};
+	auto skipFString = [&]() {
+		int32_t length = readInt(position);
+		position += sizeof(int32_t) + static_cast<size_t>(length < 0 ? -static_cast<int64_t>(length) * 2 : length);
+	};
+	int32_t count = readInt(position);
+	position += sizeof(int32_t);
+	for (int32_t i = 0; i < count; ++i) {
+		skipFString();
+		skipFString();
+		patch<int32_t>(position, static_cast<int32_t>(relocate(readInt(position))));
+		position += sizeof(int32_t);
+	}
+}
+
+void UassetWriter::patchSummary() {
+	const UassetData::Header& header = data_.header;
+	const UassetData::SummaryLayout& layout = data_.summaryLayout;
+	auto patch32 = [&](size_t position, int64_t value) {
+		if (position != 0) {
+			patch<int32_t>(position, static_cast<int32_t>(value));
+		}
+	};
+	patch32(layout.TotalHeaderSize, relocate(header.TotalHeaderSize));
+	patch32(layout.NameCount, static_cast<int64_t>(data_.names.size()));
+	patch32(layout.NameOffset, relocate(header.NameOffset));
+	patch32(layout.SoftObjectPathsOffset, relocate(header.SoftObjectPathsOffset));
+	patch32(layout.GatherableTextDataOffset, relocate(header.GatherableTextDataOffset));
+	patch32(layout.ExportOffset, relocate(header.ExportOffset));
+	patch32(layout.ImportOffset, relocate(header.ImportOffset));
+	patch32(layout.DependsOffset, relocate(header.DependsOffset));
+	patch32(layout.SoftPackageReferencesOffset, relocate(header.SoftPackageReferencesOffset));
+	patch32(layout.SearchableNamesOffset, relocate(header.SearchableNamesOffset));
+	patch32(layout.ThumbnailTableOffset, relocate(header.ThumbnailTableOffset));
+	patch32(layout.AssetRegistryDataOffset, relocate(header.AssetRegistryDataOffset));
+	patch32(layout.WorldTileInfoDataOffset, relocate(header.WorldTileInfoDataOffset));
+	patch32(layout.PreloadDependencyOffset, relocate(header.PreloadDependencyOffset));
+	patch32(layout.DataResourceOffset, relocate(header.DataResourceOffset));
+	if (layout.BulkDataStartOffset != 0) {
+		patch<int64_t>(layout.BulkDataStartOffset, relocate(header.BulkDataStartOffset));
+	}
+	if (layout.PayloadTocOffset != 0) {
+		patch<int64_t>(layout.PayloadTocOffset, relocate(header.PayloadTocOffset));
+	}
+}
+
+// Hash of each export's serialized body (serialOffset/serialSize range); 0 for empty or out-of-range bodies
+std::vector<uint64_t> hashExportBodies(const UassetData& data, const std::vector<uint8_t>& bytes) {
+	const UassetData::ExportMap& map = data.exportMap;
+	std::vector<uint64_t> hashes(map.size(), 0);
+	for (size_t i = 0; i < map.size(); ++i) {
+		int64_t offset = map.serialOffset[i];
+		int64_t size = map.serialSize[i];
+		if (size > 0 && offset >= 0 && static_cast<uint64_t>(offset + size) <= bytes.size()) {
+			hashes[i] = hashBytes(bytes.data() + offset, static_cast<size_t>(size));
+		}
+	}
+	return hashes;
+}
+
+std::string propertyValueString(const UassetData::Export::Property& property) {
+	if (property.PropertyType == "bool") {
+		return property.boolValue ? "true" : "false";
+	}
+	if (property.PropertyType == "int") {
+		return std::to_string(property.intValue);
+	}
+	if (property.PropertyType == "float") {
+		std::ostringstream ss;
+		ss << property.floatValue;
+		return ss.str();
+	}
+	if (property.PropertyType == "FString") {
+		return property.stringValue;
+	}
+	return std::to_string(property.byteBuffer.size()) + " bytes";
+}
+
+// Structural differences between two parsed revisions of a package. Names and imports are
+// compared as sets; exports are aligned by full object path and only those whose body
+// hashes differ have their export-map fields and property lists compared.
+struct UassetDiff {
+	struct PropertyChange {
+		std::string name;
+		std::string before;  // empty when added
+		std::string after;   // empty when removed
+	};
+
+	struct ExportChange {
+		std::string path;
+		bool bodyChanged = false;
+		std::vector<std::string> fieldChanges;
+		std::vector<PropertyChange> propertyChanges;
+	};
+
+	std::vector<std::string> namesAdded;
+	std::vector<std::string> namesRemoved;
+	std::vector<std::string> importsAdded;
+	std::vector<std::string> importsRemoved;
+	std::vector<std::string> exportsAdded;
+	std::vector<std::string> exportsRemoved;
+	std::vector<ExportChange> exportsChanged;
+	size_t exportsIdentical = 0;
+
+	bool empty() const {
+		return namesAdded.empty() && namesRemoved.empty() && importsAdded.empty() && importsRemoved.empty()
+			&& exportsAdded.empty() && exportsRemoved.empty() && exportsChanged.empty();
+	}
+};
+
+// Elements of a that are missing from b, in a's order
+static std::vector<std::string> missingFrom(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+	std::unordered_map<std::string, size_t> counts;
+	for (const std::string& item : b) {
+		++counts[item];
+	}
+	std::vector<std::string> result;
+	for (const std::string& item : a) {
+		auto it = counts.find(item);
+		if (it == counts.end() || it->second == 0) {
+			result.push_back(item);
+		}
+		else {
+			--it->second;
+		}
+	}
+	return result;
+}
+
+// Properties keyed by name and occurrence, so repeated names (array elements, map entries) pair up in order
+static std::vector<std::pair<std::string, std::string>> keyedProperties(const UassetData::Export& exportData) {
+	std::unordered_map<std::string, size_t> seen;
+	std::vector<std::pair<std::string, std::string>> result;
+	result.reserve(exportData.properties.size());
+	for (const UassetData::Export::Property& property : exportData.properties) {
+		size_t occurrence = seen[property.PropertyName]++;
+		std::string key = occurrence == 0 ? property.PropertyName : property.PropertyName + "#" + std::to_string(occurrence);
+		result.push_back({ key, propertyValueString(property) });
+	}
+	return result;
+}
+
+UassetDiff diffUassets(const UassetData& a, const std::vector<uint64_t>& hashesA, const UassetData& b, const std::vector<uint64_t>& hashesB) {
+	UassetDiff diff;
+
+	std::vector<std::string> namesA, namesB, importsA, importsB;
+	for (const UassetData::Name& name : a.names) namesA.push_back(name.Name);
+	for (const UassetData::Name& name : b.names) namesB.push_back(name.Name);
+	for (const UassetData::ObjectGraph::Object& object : a.objectGraph.imports) importsA.push_back(object.fullPath);
+	for (const UassetData::ObjectGraph::Object& object : b.objectGraph.imports) importsB.push_back(object.fullPath);
+	diff.namesAdded = missingFrom(namesB, namesA);
+	diff.namesRemoved = missingFrom(namesA, namesB);
+	diff.importsAdded = missingFrom(importsB, importsA);
+	diff.importsRemoved = missingFrom(importsA, importsB);
+
+	// Align exports by path; duplicates pair up in table order
+	std::unordered_map<std::string, std::vector<size_t>> exportsByPath;
+	for (size_t i = b.objectGraph.exports.size(); i-- > 0;) {
+		exportsByPath[b.objectGraph.exports[i].fullPath].push_back(i);
+	}
+	std::vector<uint8_t> matchedB(b.exports.size(), 0);
+	for (size_t i = 0; i < a.exports.size() && i < a.objectGraph.exports.size(); ++i) {
+		const std::string& path = a.objectGraph.exports[i].fullPath;
+		auto it = exportsByPath.find(path);
+		if (it == exportsByPath.end() || it->second.empty()) {
+			diff.exportsRemoved.push_back(path);
+			continue;
+		}
+		size_t j = it->second.back();
+		it->second.pop_back();
+		matchedB[j] = 1;
+
+		const UassetData::ExportMap& mapA = a.exportMap;
+		const UassetData::ExportMap& mapB = b.exportMap;
+		// Class, super and template are compared by path: a reparented export keeps its body
+		const std::string& classA = a.objectGraph.fullPath(mapA.classIndex[i]).empty() ? a.objectGraph.className(static_cast<int32_t>(i) + 1) : a.objectGraph.fullPath(mapA.classIndex[i]);
+		const std::string& classB = b.objectGraph.fullPath(mapB.classIndex[j]).empty() ? b.objectGraph.className(static_cast<int32_t>(j) + 1) : b.objectGraph.fullPath(mapB.classIndex[j]);
+		const std::string& superA = a.objectGraph.fullPath(mapA.superIndex[i]);
+		const std::string& superB = b.objectGraph.fullPath(mapB.superIndex[j]);
+		const std::string& templateA = a.objectGraph.fullPath(mapA.templateIndex[i]);
+		const std::string& templateB = b.objectGraph.fullPath(mapB.templateIndex[j]);
+		if (hashesA[i] == hashesB[j] && mapA.serialSize[i] == mapB.serialSize[j] && mapA.objectFlags[i] == mapB.objectFlags[j]
+			&& classA == classB && superA == superB && templateA == templateB) {
+			++diff.exportsIdentical;
+			continue;
+		}
+
+		UassetDiff::ExportChange change;
+		change.path = path;
+		change.bodyChanged = hashesA[i] != hashesB[j] || mapA.serialSize[i] != mapB.serialSize[j];
+		auto compareField = [&](const char* field, const std::string& before, const std::string& after) {
+			if (before != after) {
+				change.fieldChanges.push_back(std::string(field) + ": " + before + " -> " + after);
+			}
+		};
+		compareField("class", classA, classB);
+		compareField("super", superA, superB);
+		compareField("template", templateA, templateB);
+		compareField("objectFlags", std::to_string(mapA.objectFlags[i]), std::to_string(mapB.objectFlags[j]));
+		compareField("serialSize", std::to_string(mapA.serialSize[i]), std::to_string(mapB.serialSize[j]));
+
+		std::vector<std::pair<std::string, std::string>> propertiesA = keyedProperties(a.exports[i]);
+		std::vector<std::pair<std::string, std::string>> propertiesB = keyedProperties(b.exports[j]);
+		std::unordered_map<std::string, const std::string*> valuesB;
+		for (const auto& property : propertiesB) {
+			valuesB[property.first] = &property.second;
+		}
+		for (const auto& property : propertiesA) {
+			auto found = valuesB.find(property.first);
+			if (found == valuesB.end()) {
+				change.propertyChanges.push_back({ property.first, property.second, "" });
+				continue;
+			}
+			if (*found->second != property.second) {
+				change.propertyChanges.push_back({ property.first, property.second, *found->second });
+			}
+			valuesB.erase(found);
+		}
+		for (const auto& property : propertiesB) {
+			if (valuesB.count(property.first) != 0) {
+				change.propertyChanges.push_back({ property.first, "", property.second });
+			}
+		}
+		diff.exportsChanged.push_back(change);
+	}
+	for (size_t j = 0; j < b.objectGraph.exports.size(); ++j) {
+		if (!matchedB[j]) {
+			diff.exportsAdded.push_back(b.objectGraph.exports[j].fullPath);
+		}
+	}
+	return diff;
+}
+
+// Blueprint node graph rebuilt from the flat property lists. Nodes are the exports listed by a
+// graph's AllNodes/Nodes/RootNodes arrays or carrying a NodeGuid. Pins are the then/exec/delegate/
+// object/self records in a node's properties; the links of pin p are linkTargets[p.firstLink ..
+// p.firstLink + p.linkCount). Node-to-node edges are stored in CSR form: the successors of node n
+// are targets[offsets[n] .. offsets[n + 1]).
+class BlueprintGraph {
+public:
+	enum PinKind : uint8_t { ExecPin, ThenPin, SelfPin, DelegatePin, ObjectPin, OutputDelegatePin, PinKindCount };
+
+	struct Node {
+		int32_t exportIndex;     // 1-based package index
+		int32_t graphIndex;      // export of the graph listing this node, 0 if none
+		uint32_t classId;        // index into classNames
+		int32_t posX;
+		int32_t posY;
+		uint32_t firstPin;
+		uint32_t pinCount;
+	};
+
+	struct Pin {
+		uint32_t node;
+		PinKind kind;
+		uint32_t firstLink;
+		uint32_t linkCount;
+	};
+
+	std::vector<Node> nodes;
+	std::vector<Pin> pins;
+	std::vector<uint32_t> linkTargets;
+	std::vector<uint32_t> offsets;
+	std::vector<uint32_t> targets;
+	std::vector<std::string> classNames;
+	std::vector<uint32_t> nodeOfExport;   // export i -> node id, InvalidNode if not a node
+	size_t unresolvedLinks = 0;
+
+	static constexpr uint32_t InvalidNode = UINT32_MAX;
+	static const char* pinKindName(PinKind kind);
+
+	void build(const UassetData& data);
+
+	size_t edgeCount() const { return targets.size(); }
+	uint32_t findByExport(int32_t exportIndex) const;
+	const std::string& className(uint32_t node) const { return classNames[nodes[node].classId]; }
+	bool isEntry(uint32_t node) const;
+	std::vector<uint32_t> entries() const;
+	std::vector<uint32_t> reachableFrom(const std::vector<uint32_t>& roots) const;
+	std::vector<uint32_t> deadNodes() const;
+};
+
+const char* BlueprintGraph::pinKindName(PinKind kind) {
+	static const char* names[PinKindCount] = { "exec", "then", "self", "delegate", "object", "OutputDelegate" };
+	return kind < PinKindCount ? names[kind] : "";
+}
+
+// Maps the part of a handler's property name before " - " to a pin kind
+static bool pinKindOf(const std::string& root, BlueprintGraph::PinKind& kind) {
+	static const std::pair<const char*, BlueprintGraph::PinKind> roots[] = {
+		{ "Exec", BlueprintGraph::ExecPin }, { "Then", BlueprintGraph::ThenPin },
+		{ "Self", BlueprintGraph::SelfPin }, { "delegate", BlueprintGraph::DelegatePin },
+		{ "Delegate", BlueprintGraph::DelegatePin }, { "object", BlueprintGraph::ObjectPin },
+		{ "OutputDelegate", BlueprintGraph::OutputDelegatePin },
+	};
+	for (const auto& entry : roots) {
+		if (root == entry.first) {
+			kind = entry.second;
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool isNodeListEntry(const std::string& name) {
+	return name.compare(0, 9, "AllNodes[") == 0 || name.compare(0, 5, "Node[") == 0 || name.compare(0, 10, "RootNodes[") == 0;
+}
+
+void BlueprintGraph::build(const UassetData& data) {
+	nodes.clear();
+	pins.clear();
+	linkTargets.clear();
+	classNames.clear();
+	unresolvedLinks = 0;
+
+	const size_t exportCount = data.exports.size();
+	std::vector<int32_t> owner(exportCount, -1);   // -1 not a node, 0 node without graph, else graph export
+	for (size_t e = 0; e < exportCount; ++e) {
+		for (const UassetData::Export::Property& property : data.exports[e].properties) {
+			if (isNodeListEntry(property.PropertyName)) {
+				int32_t index = property.intValue;
+				if (index > 0 && static_cast<size_t>(index) <= exportCount && owner[index - 1] <= 0) {
+					owner[index - 1] = static_cast<int32_t>(e) + 1;
+				}
+			}
+			else if (property.PropertyName == "NodeGuid" && owner[e] < 0) {
+				owner[e] = 0;
+			}
+		}
+	}
+
+	nodeOfExport.assign(exportCount, InvalidNode);
+	std::unordered_map<std::string, uint32_t> classIds;
+	std::unordered_map<std::string, uint32_t> nodeOfGuid;
+	for (size_t e = 0; e < exportCount; ++e) {
+		if (owner[e] < 0) {
+			continue;
+		}
+		uint32_t id = static_cast<uint32_t>(nodes.size());
+		nodeOfExport[e] = id;
+		Node node = { static_cast<int32_t>(e) + 1, owner[e], 0, 0, 0, 0, 0 };
+		const std::string& name = data.objectGraph.className(node.exportIndex);
+		auto found = classIds.find(name);
+		if (found == classIds.end()) {
+			found = classIds.emplace(name, static_cast<uint32_t>(classNames.size())).first;
+			classNames.push_back(name);
+		}
+		node.classId = found->second;
+		for (const UassetData::Export::Property& property : data.exports[e].properties) {
+			if (property.PropertyName == "NodePosX") {
+				node.posX = property.intValue;
+			}
+			else if (property.PropertyName == "NodePosY") {
+				node.posY = property.intValue;
+			}
+			else if (property.PropertyName == "NodeGuid") {
+				nodeOfGuid.emplace(property.stringValue, id);
+			}
+		}
+		nodes.push_back(node);
+	}
+
+	// Pins: a record starts at its bare name ("Exec") or first info field and collects the
+	// "<Kind> - Entity" references that follow; each reference is a link to another node.
+	std::vector<std::pair<uint32_t, uint32_t>> edges;
+	for (uint32_t id = 0; id < nodes.size(); ++id) {
+		const std::vector<UassetData::Export::Property>& properties = data.exports[nodes[id].exportIndex - 1].properties;
+		nodes[id].firstPin = static_cast<uint32_t>(pins.size());
+		std::string currentRoot;
+		std::string previousField;
+		for (size_t p = 0; p < properties.size(); ++p) {
+			const std::string& name = properties[p].PropertyName;
+			size_t dash = name.find(" - ");
+			std::string root = name.substr(0, dash);
+			std::string field = dash == std::string::npos ? "" : name.substr(dash + 3);
+			PinKind kind;
+			if (!pinKindOf(root, kind)) {
+				currentRoot.clear();
+				continue;
+			}
+			bool startsPin = root != currentRoot || field.empty() || field == "info1"
+				|| (field == "info4" && previousField != "info3");
+			if (startsPin) {
+				pins.push_back({ id, kind, static_cast<uint32_t>(linkTargets.size()), 0 });
+				currentRoot = root;
+			}
+			previousField = field;
+			if (field != "Entity") {
+				continue;
+			}
+
+			uint32_t target = InvalidNode;
+			int32_t index = properties[p].intValue;
+			if (index > 0 && static_cast<size_t>(index) <= exportCount) {
+				target = nodeOfExport[index - 1];
+			}
+			if (target == InvalidNode && p + 1 < properties.size() && properties[p + 1].PropertyName == root + " - Entity Guid") {
+				auto found = nodeOfGuid.find(properties[p + 1].stringValue);
+				if (found != nodeOfGuid.end()) {
+					target = found->second;
+				}
+			}
+			if (target == InvalidNode) {
+				++unresolvedLinks;
+			}
+			else if (target != id) {
+				linkTargets.push_back(target);
+				++pins.back().linkCount;
+				edges.push_back({ id, target });
+			}
+		}
+		nodes[id].pinCount = static_cast<uint32_t>(pins.size()) - nodes[id].firstPin;
+	}
+
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+	offsets.assign(nodes.size() + 1, 0);
+	targets.resize(edges.size());
+	for (size_t e = 0; e < edges.size(); ++e) {
+		++offsets[edges[e].first + 1];
+		targets[e] = edges[e].second;
+	}
+	for (size_t n = 0; n < nodes.size(); ++n) {
+		offsets[n + 1] += offsets[n];
+	}
+}
+
+uint32_t BlueprintGraph::findByExport(int32_t exportIndex) const {
+	if (exportIndex <= 0 || static_cast<size_t>(exportIndex) > nodeOfExport.size()) {
+		return InvalidNode;
+	}
+	return nodeOfExport[exportIndex - 1];
+}
+
+// Events, input handlers and function entries are where execution starts
+bool BlueprintGraph::isEntry(uint32_t node) const {
+	const std::string& name = className(node);
+	return name.find("Event") != std::string::npos || name.compare(0, 12, "K2Node_Input") == 0
+		|| name == "K2Node_FunctionEntry";
+}
+
+std::vector<uint32_t> BlueprintGraph::entries() const {
+	std::vector<uint32_t> result;
+	for (uint32_t n = 0; n < nodes.size(); ++n) {
+		if (isEntry(n)) {
+			result.push_back(n);
+		}
+	}
+	return result;
+}
+
+// Breadth-first walk over the node CSR; the result includes the roots
+std::vector<uint32_t> BlueprintGraph::reachableFrom(const std::vector<uint32_t>& roots) const {
+	std::vector<uint8_t> visited(nodes.size(), 0);
+	std::vector<uint32_t> queue;
+	for (uint32_t root : roots) {
+		if (root < nodes.size() && !visited[root]) {
+			visited[root] = 1;
+			queue.push_back(root);
+		}
+	}
+	for (size_t head = 0; head < queue.size(); ++head) {
+		uint32_t current = queue[head];
+		for (uint32_t e = offsets[current]; e < offsets[current + 1]; ++e) {
+			uint32_t next = targets[e];
+			if (!visited[next]) {
+				visited[next] = 1;
+				queue.push_back(next);
+			}
+		}
+	}
+	return queue;
+}
+
+// Nodes no entry can reach. Comment boxes never take part in execution and are left out.
+std::vector<uint32_t> BlueprintGraph::deadNodes() const {
+	std::vector<uint8_t> live(nodes.size(), 0);
+	for (uint32_t n : reachableFrom(entries())) {
+		live[n] = 1;
+	}
+	std::vector<uint32_t> result;
+	for (uint32_t n = 0; n < nodes.size(); ++n) {
+		if (!live[n] && className(n).find("Comment") == std::string::npos) {
+			result.push_back(n);
+		}
+	}
+	return result;
+}
+
+// Kismet script disassembler. UFunction exports end with the compiled script followed by
+// FunctionFlags, [RepOffset,] EventGraphFunction and EventGraphCallOffset; the script is
+// prefixed by its in-memory and serialized sizes. Opcodes are decoded from a 256-entry table
+// whose operand string lists what follows each token:
+//   E expression  L expressions up to EX_EndFunctionParms  Z expressions up to the entry's terminator
+//   B uint8  H uint16  I int32  Q int64  F float  D double  R float or double (large world coordinates)
+//   N FName  O object ref  P property path  S ANSI string  U UTF-16 string
+//   T text constant  W switch value  V instrumentation event
+struct KismetInstruction {
+	uint32_t offset;          // from the start of the script
+	uint8_t opcode;
+	uint16_t depth;           // nesting level; operands of an expression follow it one level deeper
+	int32_t objectRef = 0;    // first object operand (callee, cast class, struct, ...)
+	std::string name;         // first FName or property path operand
+	std::string literal;      // remaining scalar operands
+};
+
+struct KismetFunction {
+	int32_t exportIndex;      // 1-based package index
+	int64_t scriptOffset = 0; // absolute file offset of the first opcode
+	int32_t bytecodeSize = 0; // in-memory size recorded by the engine
+	int32_t scriptSize = 0;   // serialized size
+	std::vector<KismetInstruction> instructions;
+	std::string error;
+};
+
+struct KismetOpcode {
+	const char* name;
+	const char* operands;
+	uint8_t terminator;
+};
+
+static const std::vector<KismetOpcode>& kismetOpcodeTable() {
+	static const std::vector<KismetOpcode> table = [] {
+		std::vector<KismetOpcode> ops(256, KismetOpcode{ nullptr, "", 0 });
+		auto set = [&ops](uint8_t token, const char* name, const char* operands, uint8_t terminator = 0) {
+			ops[token] = { name, operands, terminator };
+		};
+		set(0x00, "LocalVariable", "P");
+		set(0x01, "InstanceVariable", "P");
+		set(0x02, "DefaultVariable", "P");
+		set(0x04, "Return", "E");
+		set(0x06, "Jump", "I");
+		set(0x07, "JumpIfNot", "IE");
+		set(0x09, "Assert", "HBE");
+		set(0x0B, "Nothing", "");
+		set(0x0C, "NothingInt32", "I");
+		set(0x0F, "Let", "PEE");
+		set(0x11, "BitFieldConst", "PB");
+		set(0x12, "ClassContext", "EIPE");
+		set(0x13, "MetaCast", "OE");
+		set(0x14, "LetBool", "EE");
+		set(0x15, "EndParmValue", "");
+		set(0x16, "EndFunctionParms", "");
+		set(0x17, "Self", "");
+		set(0x18, "Skip", "IE");
+		set(0x19, "Context", "EIPE");
+		set(0x1A, "Context_FailSilent", "EIPE");
+		set(0x1B, "VirtualFunction", "NL");
+		set(0x1C, "FinalFunction", "OL");
+		set(0x1D, "IntConst", "I");
+		set(0x1E, "FloatConst", "F");
+		set(0x1F, "StringConst", "S");
+		set(0x20, "ObjectConst", "O");
+		set(0x21, "NameConst", "N");
+		set(0x22, "RotationConst", "RRR");
+		set(0x23, "VectorConst", "RRR");
+		set(0x24, "ByteConst", "B");
+		set(0x25, "IntZero", "");
+		set(0x26, "IntOne", "");
+		set(0x27, "True", "");
+		set(0x28, "False", "");
+		set(0x29, "TextConst", "T");
+		set(0x2A, "NoObject", "");
+		set(0x2B, "TransformConst", "RRRRRRRRRR");
+		set(0x2C, "IntConstByte", "B");
+		set(0x2D, "NoInterface", "");
+		set(0x2E, "DynamicCast", "OE");
+		set(0x2F, "StructConst", "OIZ", 0x30);
+		set(0x30, "EndStructConst", "");
+		set(0x31, "SetArray", "EZ", 0x32);
+		set(0x32, "EndArray", "");
+		set(0x33, "PropertyConst", "P");
+		set(0x34, "UnicodeStringConst", "U");
+		set(0x35, "Int64Const", "Q");
+		set(0x36, "UInt64Const", "Q");
+		set(0x37, "DoubleConst", "D");
+		set(0x38, "Cast", "BE");
+		set(0x39, "SetSet", "EIZ", 0x3A);
+		set(0x3A, "EndSet", "");
+		set(0x3B, "SetMap", "EIZ", 0x3C);
+		set(0x3C, "EndMap", "");
+		set(0x3D, "SetConst", "PIZ", 0x3E);
+		set(0x3E, "EndSetConst", "");
+		set(0x3F, "MapConst", "PPIZ", 0x40);
+		set(0x40, "EndMapConst", "");
+		set(0x41, "Vector3fConst", "FFF");
+		set(0x42, "StructMemberContext", "PE");
+		set(0x43, "LetMulticastDelegate", "EE");
+		set(0x44, "LetDelegate", "EE");
+		set(0x45, "LocalVirtualFunction", "NL");
+		set(0x46, "LocalFinalFunction", "OL");
+		set(0x48, "LocalOutVariable", "P");
+		set(0x4A, "DeprecatedOp4A", "");
+		set(0x4B, "InstanceDelegate", "N");
+		set(0x4C, "PushExecutionFlow", "I");
+		set(0x4D, "PopExecutionFlow", "");
+		set(0x4E, "ComputedJump", "E");
+		set(0x4F, "PopExecutionFlowIfNot", "E");
+		set(0x50, "Breakpoint", "");
+		set(0x51, "InterfaceContext", "E");
+		set(0x52, "ObjToInterfaceCast", "OE");
+		set(0x53, "EndOfScript", "");
+		set(0x54, "CrossInterfaceCast", "OE");
+		set(0x55, "InterfaceToObjCast", "OE");
+		set(0x5A, "WireTracepoint", "");
+		set(0x5B, "SkipOffsetConst", "I");
+		set(0x5C, "AddMulticastDelegate", "EE");
+		set(0x5D, "ClearMulticastDelegate", "E");
+		set(0x5E, "Tracepoint", "");
+		set(0x5F, "LetObj", "EE");
+		set(0x60, "LetWeakObjPtr", "EE");
+		set(0x61, "BindDelegate", "NEE");
+		set(0x62, "RemoveMulticastDelegate", "EE");
+		set(0x63, "CallMulticastDelegate", "OL");
+		set(0x64, "LetValueOnPersistentFrame", "PE");
+		set(0x65, "ArrayConst", "PIZ", 0x66);
+		set(0x66, "EndArrayConst", "");
+		set(0x67, "SoftObjectConst", "E");
+		set(0x68, "CallMath", "OL");
+		set(0x69, "SwitchValue", "W");
+		set(0x6A, "InstrumentationEvent", "V");
+		set(0x6B, "ArrayGetByRef", "EE");
+		set(0x6C, "ClassSparseDataVariable", "P");
+		set(0x6D, "FieldPathConst", "E");
+		return ops;
+	}();
+	return table;
+}
+
+class KismetDisassembler {
+public:
+	explicit KismetDisassembler(const UassetData& data);
+
+	bool locateScript(const std::vector<uint8_t>& bytes, int32_t exportIndex, KismetFunction& function) const;
+	KismetFunction disassemble(const std::vector<uint8_t>& bytes, int32_t exportIndex) const;
+	void decode(const uint8_t* script, size_t size, std::vector<KismetInstruction>& out) const;
+
+	static const char* mnemonic(uint8_t opcode);
+	static bool isCall(uint8_t opcode);
+
+private:
+	struct Cursor {
+		const uint8_t* begin;
+		const uint8_t* ptr;
+		const uint8_t* end;
+	};
+
+	static const int MaxDepth = 256;
+	const UassetData& data_;
+	bool largeWorldCoordinates_;
+	bool fieldPaths_;
+
+	template <typename T>
+	static T take(Cursor& cursor) {
+		if (static_cast<size_t>(cursor.end - cursor.ptr) < sizeof(T)) {
+			throw ParseException("Kismet script truncated at offset " + std::to_string(cursor.ptr - cursor.begin));
+		}
+		T val;
+		std::memcpy(&val, cursor.ptr, sizeof(val));
+		cursor.ptr += sizeof(val);
+		return val;
+	}
+
+	std::string name(Cursor& cursor) const;
+	void expression(Cursor& cursor, uint16_t depth, std::vector<KismetInstruction>& out) const;
+	void operands(Cursor& cursor, const char* codes, uint8_t terminator, uint16_t depth, KismetInstruction& instruction, std::vector<KismetInstruction>& out) const;
+	void expressionsUntil(Cursor& cursor, uint8_t terminator, uint16_t depth, std::vector<KismetInstruction>& out) const;
+};
+
+KismetDisassembler::KismetDisassembler(const UassetData& data) : data_(data) {
+	largeWorldCoordinates_ = data.header.FileVersionUE5 >= 0x03EC;  // VER_UE5_LARGE_WORLD_COORDINATES
+	fieldPaths_ = data.header.FileVersionUE5 > 0 || data.header.FileVersionUE4 >= 0x0206;  // FField properties (4.25)
+}
+
+const char* KismetDisassembler::mnemonic(uint8_t opcode) {
+	const char* name = kismetOpcodeTable()[opcode].name;
+	return name ? name : "?";
+}
+
+bool KismetDisassembler::isCall(uint8_t opcode) {
+	switch (opcode) {
+	case 0x1B: case 0x1C: case 0x45: case 0x46: case 0x63: case 0x68:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Finds the script inside a Function export by checking which position is followed by exactly
+// SerializedScriptSize bytes before the function trailer.
+bool KismetDisassembler::locateScript(const std::vector<uint8_t>& bytes, int32_t exportIndex, KismetFunction& function) const {
+	const UassetData::ExportMap& map = data_.exportMap;
+	size_t i = static_cast<size_t>(exportIndex) - 1;
+	int64_t start = map.serialOffset[i];
+	int64_t end = start + map.serialSize[i];
+	if (start < 0 || end > static_cast<int64_t>(bytes.size()) || map.serialSize[i] < 20) {
+		return false;
+	}
+	auto int32At = [&](int64_t offset) {
+		int32_t val;
+		std::memcpy(&val, bytes.data() + offset, sizeof(val));
+		return val;
+	};
+
+	const uint32_t FUNC_Net = 0x00000040;
+	for (int64_t trailer : { 12, 14 }) {
+		int64_t scriptEnd = end - trailer;
+		bool net = (static_cast<uint32_t>(int32At(scriptEnd)) & FUNC_Net) != 0;
+		if (net != (trailer == 14)) {
+			continue;
+		}
+		for (int64_t p = start + 8; p <= scriptEnd; ++p) {
+			int32_t serialized = int32At(p - 4);
+			if (serialized != scriptEnd - p || int32At(p - 8) < serialized) {
+				continue;
+			}
+			if (serialized > 0 && bytes[scriptEnd - 1] != 0x53) {  // EX_EndOfScript
+				continue;
+			}
+			function.scriptOffset = p;
+			function.scriptSize = serialized;
+			function.bytecodeSize = int32At(p - 8);
+			return true;
+		}
+	}
+	return false;
+}
+
+KismetFunction KismetDisassembler::disassemble(const std::vector<uint8_t>& bytes, int32_t exportIndex) const {
+	KismetFunction function;
+	function.exportIndex = exportIndex;
+	if (!locateScript(bytes, exportIndex, function)) {
+		function.error = "script not found";
+		return function;
+	}
+	try {
+		decode(bytes.data() + function.scriptOffset, static_cast<size_t>(function.scriptSize), function.instructions);
+	}
+	catch (const ParseException& e) {
+		function.error = e.what();
+	}
+	return function;
+}
+
+void KismetDisassembler::decode(const uint8_t* script, size_t size, std::vector<KismetInstruction>& out) const {
+	Cursor cursor = { script, script, script + size };
+	while (cursor.ptr < cursor.end) {
+		expression(cursor, 0, out);
+	}
+}
+
+std::string KismetDisassembler::name(Cursor& cursor) const {
+	int32_t index = take<int32_t>(cursor);
+	int32_t number = take<int32_t>(cursor);
+	if (index < 0 || static_cast<size_t>(index) >= data_.names.size()) {
+		return "#" + std::to_string(index);
+	}
+	const std::string& base = data_.names[index].Name;
+	return number > 0 ? base + "_" + std::to_string(number - 1) : base;
+}
+
+void KismetDisassembler::expression(Cursor& cursor, uint16_t depth, std::vector<KismetInstruction>& out) const {
+	if (depth > MaxDepth) {
+		throw ParseException("Kismet expression nested too deeply");
+	}
+	uint32_t offset = static_cast<uint32_t>(cursor.ptr - cursor.begin);
+	uint8_t opcode = take<uint8_t>(cursor);
+	const KismetOpcode& op = kismetOpcodeTable()[opcode];
+	if (!op.name) {
+		throw ParseException("Unknown Kismet opcode " + std::to_string(opcode) + " at offset " + std::to_string(offset));
+	}
+	size_t index = out.size();
+	out.push_back(KismetInstruction{ offset, opcode, depth, 0, std::string(), std::string() });
+	KismetInstruction instruction = out[index];
+	operands(cursor, op.operands, op.terminator, depth, instruction, out);
+	out[index] = std::move(instruction);
+}
+
+void KismetDisassembler::expressionsUntil(Cursor& cursor, uint8_t terminator, uint16_t depth, std::vector<KismetInstruction>& out) const {
+	while (true) {
+		if (cursor.ptr >= cursor.end) {
+			throw ParseException("Kismet list not terminated");
+		}
+		bool last = *cursor.ptr == terminator;
+		expression(cursor, depth, out);
+		if (last) {
+			return;
+		}
+	}
+}
+
+void KismetDisassembler::operands(Cursor& cursor, const char* codes, uint8_t terminator, uint16_t depth, KismetInstruction& instruction, std::vector<KismetInstruction>& out) const {
+	auto literal = [&](const std::string& text) {
+		if (!instruction.literal.empty()) {
+			instruction.literal += ' ';
+		}
+		instruction.literal += text;
+	};
+	auto setName = [&](const std::string& text) {
+		if (instruction.name.empty()) {
+			instruction.name = text;
+		}
+		else {
+			literal(text);
+		}
+	};
+	auto setObject = [&](int32_t ref) {
+		if (instruction.objectRef == 0) {
+			instruction.objectRef = ref;
+		}
+		else {
+			literal(data_.objectGraph.fullPath(ref));
+		}
+	};
+	const uint16_t child = depth + 1;
+
+	for (const char* code = codes; *code; ++code) {
+		switch (*code) {
+		case 'E': expression(cursor, child, out); break;
+		case 'L': expressionsUntil(cursor, 0x16, child, out); break;  // EX_EndFunctionParms
+		case 'Z': expressionsUntil(cursor, terminator, child, out); break;
+		case 'B': literal(std::to_string(take<uint8_t>(cursor))); break;
+		case 'H': literal(std::to_string(take<uint16_t>(cursor))); break;
+		case 'I': literal(std::to_string(take<int32_t>(cursor))); break;
+		case 'Q': literal(std::to_string(take<int64_t>(cursor))); break;
+		case 'F': literal(std::to_string(take<float>(cursor))); break;
+		case 'D': literal(std::to_string(take<double>(cursor))); break;
+		case 'R': literal(std::to_string(largeWorldCoordinates_ ? take<double>(cursor) : take<float>(cursor))); break;
+		case 'N': setName(name(cursor)); break;
+		case 'O': setObject(take<int32_t>(cursor)); break;
+		case 'P':
+			if (fieldPaths_) {
+				int32_t count = take<int32_t>(cursor);
+				if (count < 0 || count > 64) {
+					throw ParseException("Invalid Kismet property path length " + std::to_string(count));
+				}
+				std::string path;
+				for (int32_t k = 0; k < count; ++k) {
+					path += (k ? "." : "") + name(cursor);
+				}
+				setName(path);
+				take<int32_t>(cursor);  // resolved owner
+			}
+			else {
+				setObject(take<int32_t>(cursor));
+			}
+			break;
+		case 'S': {
+			std::string text;
+			char c;
+			while ((c = static_cast<char>(take<uint8_t>(cursor))) != 0) {
+				text += c;
+			}
+			literal("\"" + text + "\"");
+			break;
+		}
+		case 'U': {
+			std::string text;
+			uint16_t c;
+			while ((c = take<uint16_t>(cursor)) != 0) {
+				text += c < 0x80 ? static_cast<char>(c) : '?';
+			}
+			literal("\"" + text + "\"");
+			break;
+		}
+		case 'T': {
+			uint8_t type = take<uint8_t>(cursor);
+			literal("text:" + std::to_string(type));
+			switch (type) {
+			case 0: break;                                                      // empty
+			case 1: operands(cursor, "EEE", 0, depth, instruction, out); break; // source, key, namespace
+			case 2: case 3: expression(cursor, child, out); break;              // invariant, literal string
+			case 4: operands(cursor, "OEE", 0, depth, instruction, out); break; // string table, table id, key
+			default: throw ParseException("Unknown Kismet text constant type " + std::to_string(type));
+			}
+			break;
+		}
+		case 'W': {
+			uint16_t cases = take<uint16_t>(cursor);
+			literal("cases:" + std::to_string(cases));
+			take<uint32_t>(cursor);  // end offset
+			expression(cursor, child, out);
+			for (uint16_t k = 0; k < cases; ++k) {
+				expression(cursor, child, out);
+				take<uint32_t>(cursor);  // next case offset
+				expression(cursor, child, out);
+			}
+			expression(cursor, child, out);
+			break;
+		}
+		case 'V': {
+			uint8_t type = take<uint8_t>(cursor);
+			literal("event:" + std::to_string(type));
+			if (type == 4) {  // EScriptInstrumentation::InlineEvent
+				setName(name(cursor));
+			}
+			break;
+		}
+		}
+	}
+}
+
+std::string resolveFNameE(const UassetData& data, int32_t idx) {
+	if (idx >= 0 && idx < data.names.size()) {
+		return data.names[idx].Name;
+	}
+	return "";
+}
+
+// Function to print bytes in rows of 8 and corresponding ASCII characters
+void printBytesAndAscii(const std::vector<unsigned char>& buffer) {
+    const size_t bytesPerRow = 8;
+
+    for (size_t i = 0; i < buffer.size(); i++) {
+        // Print the byte in hex format
+        std::cout << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(buffer[i]) << " ";
+
+        // Check if we reached the end of the row
+        if ((i + 1) % bytesPerRow == 0 || i + 1 == buffer.size()) {
+            // Calculate the start index of the current row
+            size_t start = (i / bytesPerRow) * bytesPerRow;
+            size_t end = std::min(buffer.size(), start + bytesPerRow); // Ensure 'end' is within bounds
+
+            // Add spacing if the last row is incomplete
+            if (end % bytesPerRow != 0) {
+                std::cout << std::string((bytesPerRow - (end - start)) * 3, ' ');
+            }
+
+            // Print ASCII representation for the current row
+            std::cout << " | ";
+            for (size_t j = start; j < end; j++) {
+                char ch = buffer[j];
+                std::cout << (std::isprint(static_cast<unsigned char>(ch)) ? ch : '.'); // Safely cast to prevent signed/unsigned issues
+            }
+
+            std::cout << std::endl;
+        }
+    }
+}
+
+
+void printUassetData(const UassetData& data) {
+	std::cout << "Header: " << data.header.EPackageFileTag << std::endl;
+	std::cout << "Number of names: " << data.names.size() << std::endl;
+	std::cout << "Number of imports: " << data.imports.size() << std::endl;
+	std::cout << "Number of exports: " << data.exports.size() << std::endl;
+	for (size_t i = 0; i < data.exports.size(); ++i) {
+		std::cout << "export:[" << i << "]   offset: "
+			<< data.exports.at(i).serialOffset << "  size: "
+			<< data.exports.at(i).serialSize << std::endl;
+	}
+
+	// Print names
+	for (const auto& name : data.names) {
+		std::cout << std::endl;
+		std::cout << "Name: " << name.Name << std::endl;
+		std::cout << "NonCasePreservingHash: " << name.NonCasePreservingHash << std::endl;
+		std::cout << "CasePreservingHash: " << name.CasePreservingHash << std::endl;
+	}
+
+	// Print imports
+	std::cout << "Imports:" << std::endl;
+	for (size_t i = 0; i < data.imports.size(); ++i) {
+		const auto& importA = data.imports[i];
+		std::cout << "Import #" << (i + 1) << ":" << std::endl;
+		std::cout << "  classPackage: " << importA.classPackage << std::endl;
+		std::cout << "  className: " << importA.className << std::endl;
+		std::cout << "  outerIndex: " << importA.outerIndex << std::endl;
+		std::cout << "  objectName: " << importA.objectName << std::endl;
+		std::cout << "  packageName: " << importA.packageName << std::endl;
+		std::cout << "  bImportOptional: " << importA.bImportOptional << std::endl;
+	}
+
+	// Print exports
+	std::cout << "Exports:" << std::endl;
+	for (size_t i = 0; i < data.exports.size(); ++i) {
+		const auto& exportA = data.exports[i];
+		std::cout << std::dec <<"Export #" << (i + 1) << ":" << std::endl;
+		std::cout << "  classIndex: " << exportA.classIndex << std::endl;
+		std::cout << "  superIndex: " << exportA.superIndex << std::endl;
+		std::cout << "  templateIndex: " << exportA.templateIndex << std::endl;
+		std::cout << "  outerIndex: " << exportA.outerIndex << std::endl;
+		std::cout << "  objectName: " << exportA.objectName << std::endl;
+		std::cout << "  objectFlags: " << exportA.objectFlags << std::endl;
+		std::cout << "  serialSize: " << exportA.serialSize << std::endl;
+		std::cout << "  serialOffset: " << exportA.serialOffset << std::endl;
+		std::cout << "  bForcedExport: " << exportA.bForcedExport << std::endl;
+		std::cout << "  bNotForClient: " << exportA.bNotForClient << std::endl;
+		std::cout << "  bNotForServer: " << exportA.bNotForServer << std::endl;
+		std::cout << "  packageGuid: " << exportA.packageGuid << std::endl;
+		std::cout << "  bIsInheritedInstance: " << exportA.bIsInheritedInstance << std::endl;
+		std::cout << "  packageFlags: " << exportA.packageFlags << std::endl;
+		std::cout << "  bNotAlwaysLoadedForEditorGame: " << exportA.bNotAlwaysLoadedForEditorGame << std::endl;
+		std::cout << "  bIsAsset: " << exportA.bIsAsset << std::endl;
+		std::cout << "  bGeneratePublicHash: " << exportA.bGeneratePublicHash << std::endl;
+		std::cout << "  firstExportDependency: " << exportA.firstExportDependency << std::endl;
+		std::cout << "  serializationBeforeSerializationDependencies: " << exportA.serializationBeforeSerializationDependencies << std::endl;
+		std::cout << "  createBeforeSerializationDependencies: " << exportA.createBeforeSerializationDependencies << std::endl;
+		std::cout << "  serializationBeforeCreateDependencies: " << exportA.serializationBeforeCreateDependencies << std::endl;
+		std::cout << "  createBeforeCreateDependencies: " << exportA.createBeforeCreateDependencies << std::endl;
+		for (size_t j = 0; j < exportA.data.size(); ++j) {
+			std::cout << "  data[" << j << "]: " << exportA.data[j] << std::endl;
+		}
+		// Print nested serial data
+		std::cout << "  Export Serial Data (Chunk):" << std::endl;
+
+		// Interpret the serial data as per the provided structure.
+		if (exportA.chunkData.size() > 0) {
+			const uint8_t* dataPtr = exportA.chunkData.data();
+			std::cout << "    ObjectMetadata:" << std::endl;
+			std::cout << "      ObjectName: " << exportA.metadata.ObjectName << std::endl;
+			std::cout << "      ObjectType: " << exportA.metadata.ObjectType << std::endl;
+//			std::cout << "      OuterObject: " << exportA.metadata.OuterObject << std::endl;
+
+			std::cout << "    ObjectProperties:" << std::endl;
+			for (size_t j = 0; j < exportA.properties.size(); ++j) {
+			    std::cout << "      Name: " << exportA.properties.at(j).PropertyName << "     ";
+			    std::cout << " (" << exportA.properties.at(j).PropertyType << ") ";
+				if (exportA.properties.at(j).PropertyType == "bool") {
+					std::cout << " " << exportA.properties.at(j).boolValue << " ";
+				}
+				else if (exportA.properties.at(j).PropertyType == "int") {
+					std::cout << " " << exportA.properties.at(j).intValue << " ";
+				}
+				else if (exportA.properties.at(j).PropertyType == "float") {
+					std::cout << " " << exportA.properties.at(j).floatValue << " ";
+				}
+				else if (exportA.properties.at(j).PropertyType == "FString") {
+					std::cout << " " << exportA.properties.at(j).stringValue << " ";
+				}
+				// Print raw bytes in the buffer
+				printBytesAndAscii(exportA.properties.at(j).byteBuffer);
+				std::cout << std::dec << std::endl;
+			}
+		}
+	}
+
+
+	// Print thumbnail data
+	for (const auto& thumbnail : data.thumbnails) {
+		std::cout << "Thumbnail:" << std::endl;
+		std::cout << "  Width: " << thumbnail.ImageWidth << std::endl;
+		std::cout << "  Height: " << thumbnail.ImageHeight << std::endl;
+		std::cout << "  Format: " << thumbnail.ImageFormat << std::endl;
+		std::cout << "  Data Size: " << thumbnail.ImageSizeData << std::endl;
+	}
+
+	// Print asset registry data
+	std::cout << "Asset Registry Data Size: " << data.assetRegistryData.size << std::endl;
+	std::cout << "Dependency Data Offset: " << data.assetRegistryData.DependencyDataOffset << std::endl;
+
+	for (const auto& entry : data.assetRegistryData.data) {
+		std::cout << "Object Path: " << entry.ObjectPath << std::endl;
+		std::cout << "Object Class Name: " << entry.ObjectClassName << std::endl;
+		for (const auto& tag : entry.Tags) {
+			std::cout << "  Tag Key: " << data.assetRegistryData.key(tag) << ", Tag Value: " << tag.Value << std::endl;
+		}
+	}
+}
+
+
+
+// ---------------------------------------------------------------------------
+// Project-wide batch processing
+// ---------------------------------------------------------------------------
+
+// Runs fn(state, i) for every i in [0, count) on all hardware threads. Each worker thread
+// owns one State for all the indices it takes, e.g. a Uasset that keeps its buffers from
+// one file to the next.
+template <typename State, typename Fn>
+void parallelForEach(size_t count, Fn fn) {
+	size_t threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+	threadCount = std::min(threadCount, count);
+	std::atomic<size_t> next(0);
+	std::vector<std::thread> workers;
+	for (size_t t = 0; t < threadCount; ++t) {
+		workers.emplace_back([&]() {
+			State state;
+			for (size_t i = next++; i < count; i = next++) {
+				fn(state, i);
+			}
+		});
+	}
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+// Per-worker state of the batch modes: a parser and a file buffer that keep their memory
+// from one file to the next (see Uasset::reset())
+struct PackageReader {
+	Uasset uasset;
+	std::vector<uint8_t> bytes;
+};
+
+// Runs fn(i) for every i in [0, count) on all hardware threads
+template <typename Fn>
+void parallelFor(size_t count, Fn fn) {
+	struct NoState {};
+	parallelForEach<NoState>(count, [&](NoState&, size_t i) {
+		fn(i);
+	});
+}
+
+static bool isAssetPath(const std::filesystem::path& path) {
+	std::string extension = path.extension().string();
+	return extension == ".uasset" || extension == ".umap";
+}
+
+// Recursively lists .uasset and .umap files below a directory, sorted by path
+std::vector<std::string> collectAssetFiles(const std::string& root) {
+	std::vector<std::string> files;
+	std::error_code ec;
+	for (std::filesystem::recursive_directory_iterator it(root, ec), end; it != end; it.increment(ec)) {
+		if (ec) {
+			break;
+		}
+		if (!it->is_regular_file(ec)) {
+			continue;
+		}
+		if (isAssetPath(it->path())) {
+			files.push_back(it->path().generic_string());
+		}
+	}
+	std::sort(files.begin(), files.end());
+	return files;
+}
+
+bool readFileBytes(const std::string& path, std::vector<uint8_t>& bytes, size_t maxBytes = SIZE_MAX) {
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file) {
+		return false;
+	}
+	size_t size = static_cast<size_t>(file.tellg());
+	size = std::min(size, maxBytes);
+	bytes.resize(size);
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(bytes.data()), size);
+	return static_cast<size_t>(file.gcount()) == size;
+}
+
+// Loads only the summary region of a package (everything before TotalHeaderSize:
+// names, imports, exports map, soft references, asset registry, thumbnail table) and parses
+// it without export bodies. options.readThumbnails and readAssetRegistry are left to the caller.
+bool loadPackageHeader(const std::string& path, Uasset& uasset, std::vector<uint8_t>& bytes) {
+	uasset.options.verbose = false;
+	uasset.options.readExportData = false;
+
+	const size_t probeSize = 64 * 1024;
+	if (!readFileBytes(path, bytes, probeSize) || !uasset.parseHeader(bytes)) {
+		return false;
+	}
+	size_t headerSize = static_cast<size_t>(std::max(uasset.data.header.TotalHeaderSize, 0));
+	if (headerSize > bytes.size() && !readFileBytes(path, bytes, headerSize)) {
+		return false;
+	}
+	return uasset.parse(bytes);
+}
+
+// Loads just enough of a package to decode its name table: the summary probe, extended to
+// TotalHeaderSize only when the names run past it
+bool loadPackageNames(const std::string& path, Uasset& uasset, std::vector<uint8_t>& bytes) {
+	uasset.options.verbose = false;
+
+	const size_t probeSize = 64 * 1024;
+	if (!readFileBytes(path, bytes, probeSize)) {
+		return false;
+	}
+	if (uasset.parseNames(bytes)) {
+		return true;
+	}
+	size_t headerSize = static_cast<size_t>(std::max(uasset.data.header.TotalHeaderSize, 0));
+	if (headerSize <= bytes.size() || !readFileBytes(path, bytes, headerSize)) {
+		return false;
+	}
+	return uasset.parseNames(bytes);
+}
+
+// Long package name of an asset: the summary's package name when present, otherwise
+// /Game/ followed by the path below the first Content directory, without extension
+std::string packageNameForFile(const std::string& path, const UassetData& data) {
+	if (!data.header.FolderName.empty() && data.header.FolderName[0] == '/') {
+		return data.header.FolderName;
+	}
+	std::string name = path;
+	size_t content = name.find("/Content/");
+	if (content != std::string::npos) {
+		name = "/Game/" + name.substr(content + 9);
+	}
+	size_t dot = name.find_last_of('.');
+	if (dot != std::string::npos && dot > name.find_last_of('/')) {
+		name.erase(dot);
+	}
+	return name;
+}
+
+// Outgoing package references of one asset, as found in its summary
+struct PackageDependencies {
+	std::string path;
+	std::string packageName;
+	std::vector<std::string> hard;  // packages of top-level imports
+	std::vector<std::string> soft;  // soft package references
+	bool valid = false;
+};
+
+PackageDependencies collectPackageDependencies(const std::string& path, Uasset& uasset) {
+	const UassetData& data = uasset.data;
+	PackageDependencies deps;
+	deps.path = path;
+	deps.packageName = packageNameForFile(path, data);
+	for (const UassetData::Import& importA : data.imports) {
+		if (importA.outerIndex == 0 && importA.className == "Package" && importA.objectName != deps.packageName) {
+			deps.hard.push_back(importA.objectName);
+		}
+	}
+	for (const std::string& reference : uasset.softPackageReferences()) {
+		if (!reference.empty() && reference != deps.packageName) {
+			deps.soft.push_back(reference);
+		}
+	}
+	deps.valid = true;
+	return deps;
+}
+
+// Package dependency graph in CSR form. Edges of node n are
+// targets[offsets[n] .. offsets[n + 1]); the reverse graph is stored the same way.
+class DependencyGraph {
+public:
+	enum EdgeKind : uint8_t { Hard = 0, Soft = 1 };
+
+	std::vector<std::string> packages;
+	std::unordered_map<std::string, uint32_t> packageIds;
+	std::vector<uint32_t> offsets;
+	std::vector<uint32_t> targets;
+	std::vector<uint8_t> kinds;
+	std::vector<uint32_t> reverseOffsets;
+	std::vector<uint32_t> reverseTargets;
+
+	static constexpr uint32_t InvalidNode = UINT32_MAX;
+
+	void build(const std::vector<PackageDependencies>& dependencies);
+
+	size_t nodeCount() const { return packages.size(); }
+	size_t edgeCount() const { return targets.size(); }
+	uint32_t find(const std::string& packageName) const;
+
+	std::vector<uint32_t> dependencies(uint32_t node) const;
+	std::vector<uint32_t> dependents(uint32_t node) const;
+	std::vector<uint32_t> transitiveDependencies(uint32_t node) const;
+	std::vector<uint32_t> transitiveDependents(uint32_t node) const;
+	std::vector<std::vector<uint32_t>> cycles() const;
+
+private:
+	uint32_t intern(const std::string& packageName);
+	static std::vector<uint32_t> reach(uint32_t node, const std::vector<uint32_t>& offs, const std::vector<uint32_t>& tgts);
+};
+
+uint32_t DependencyGraph::intern(const std::string& packageName) {
+	auto it = packageIds.find(packageName);
+	if (it != packageIds.end()) {
+		return it->second;
+	}
+	uint32_t id = static_cast<uint32_t>(packages.size());
+	packages.push_back(packageName);
+	packageIds.emplace(packageName, id);
+	return id;
+}
+
+uint32_t DependencyGraph::find(const std::string& packageName) const {
+	auto it = packageIds.find(packageName);
+	return it != packageIds.end() ? it->second : InvalidNode;
+}
+
+void DependencyGraph::build(const std::vector<PackageDependencies>& dependencies) {
+	packages.clear();
+	packageIds.clear();
+
+	struct Edge {
+		uint32_t from;
+		uint32_t to;
+		uint8_t kind;
+	};
+	std::vector<Edge> edges;
+
+	// Scanned packages get the low ids so they come first in the node list
+	for (const PackageDependencies& deps : dependencies) {
+		if (deps.valid) {
+			intern(deps.packageName);
+		}
+	}
+	for (const PackageDependencies& deps : dependencies) {
+		if (!deps.valid) {
+			continue;
+		}
+		uint32_t from = find(deps.packageName);
+		for (const std::string& target : deps.hard) {
+			edges.push_back({ from, intern(target), Hard });
+		}
+		for (const std::string& target : deps.soft) {
+			edges.push_back({ from, intern(target), Soft });
+		}
+	}
+
+	// Sort by (from, to, kind) and drop duplicates; a hard edge wins over a soft one
+	std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+		return a.from != b.from ? a.from < b.from : a.to != b.to ? a.to < b.to : a.kind < b.kind;
+	});
+	edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+		return a.from == b.from && a.to == b.to;
+	}), edges.end());
+
+	const size_t nodes = packages.size();
+	offsets.assign(nodes + 1, 0);
+	targets.resize(edges.size());
+	kinds.resize(edges.size());
+	reverseOffsets.assign(nodes + 1, 0);
+	reverseTargets.resize(edges.size());
+
+	for (const Edge& edge : edges) {
+		++offsets[edge.from + 1];
+		++reverseOffsets[edge.to + 1];
+	}
+	for (size_t n = 0; n < nodes; ++n) {
+		offsets[n + 1] += offsets[n];
+		reverseOffsets[n + 1] += reverseOffsets[n];
+	}
+	std::vector<uint32_t> fill(reverseOffsets.begin(), reverseOffsets.end() - 1);
+	for (size_t e = 0; e < edges.size(); ++e) {
+		targets[e] = edges[e].to;
+		kinds[e] = edges[e].kind;
+		reverseTargets[fill[edges[e].to]++] = edges[e].from;
+	}
+}
+
+std::vector<uint32_t> DependencyGraph::dependencies(uint32_t node) const {
+	return std::vector<uint32_t>(targets.begin() + offsets[node], targets.begin() + offsets[node + 1]);
+}
+
+std::vector<uint32_t> DependencyGraph::dependents(uint32_t node) const {
+	return std::vector<uint32_t>(reverseTargets.begin() + reverseOffsets[node], reverseTargets.begin() + reverseOffsets[node + 1]);
+}
+
+// Breadth-first walk over one CSR direction; returns every node reachable from node (excluding itself)
+std::vector<uint32_t> DependencyGraph::reach(uint32_t node, const std::vector<uint32_t>& offs, const std::vector<uint32_t>& tgts) {
+	std::vector<uint8_t> visited(offs.size() - 1, 0);
+	std::vector<uint32_t> result;
+	std::vector<uint32_t> queue(1, node);
+	visited[node] = 1;
+	for (size_t head = 0; head < queue.size(); ++head) {
+		uint32_t current = queue[head];
+		for (uint32_t e = offs[current]; e < offs[current + 1]; ++e) {
+			uint32_t next = tgts[e];
+			if (!visited[next]) {
+				visited[next] = 1;
+				queue.push_back(next);
+				result.push_back(next);
+			}
+		}
+	}
+	return result;
+}
+
+std::vector<uint32_t> DependencyGraph::transitiveDependencies(uint32_t node) const {
+	return reach(node, offsets, targets);
+}
+
+std::vector<uint32_t> DependencyGraph::transitiveDependents(uint32_t node) const {
+	return reach(node, reverseOffsets, reverseTargets);
+}
+
+// Strongly connected components with more than one package (iterative Tarjan)
+std::vector<std::vector<uint32_t>> DependencyGraph::cycles() const {
+	const uint32_t nodes = static_cast<uint32_t>(packages.size());
+	std::vector<uint32_t> index(nodes, InvalidNode);
+	std::vector<uint32_t> lowLink(nodes, 0);
+	std::vector<uint8_t> onStack(nodes, 0);
+	std::vector<uint32_t> stack;
+	std::vector<std::pair<uint32_t, uint32_t>> callStack; // (node, next edge)
+	std::vector<std::vector<uint32_t>> result;
+	uint32_t nextIndex = 0;
+
+	for (uint32_t root = 0; root < nodes; ++root) {
+		if (index[root] != InvalidNode) {
+			continue;
+		}
+		callStack.push_back({ root, offsets[root] });
+		index[root] = lowLink[root] = nextIndex++;
+		stack.push_back(root);
+		onStack[root] = 1;
+
+		while (!callStack.empty()) {
+			uint32_t node = callStack.back().first;
+			uint32_t& edge = callStack.back().second;
+			if (edge < offsets[node + 1]) {
+				uint32_t next = targets[edge++];
+				if (index[next] == InvalidNode) {
+					index[next] = lowLink[next] = nextIndex++;
+					stack.push_back(next);
+					onStack[next] = 1;
+					callStack.push_back({ next, offsets[next] });
+				}
+				else if (onStack[next]) {
+					lowLink[node] = std::min(lowLink[node], index[next]);
+				}
+				continue;
+			}
+
+			if (lowLink[node] == index[node]) {
+				std::vector<uint32_t> component;
+				uint32_t member;
+				do {
+					member = stack.back();
+					stack.pop_back();
+					onStack[member] = 0;
+					component.push_back(member);
+				} while (member != node);
+				if (component.size() > 1) {
+					result.push_back(component);
+				}
+			}
+			callStack.pop_back();
+			if (!callStack.empty()) {
+				uint32_t parent = callStack.back().first;
+				lowLink[parent] = std::min(lowLink[parent], lowLink[node]);
+			}
+		}
+	}
+	return result;
+}
+
+// Inverted index over asset registry tags: key -> value -> assets. Keys and values are
+// interned once for the whole project, so each posting list holds only asset ids.
+class AssetTagIndex {
+public:
+	std::vector<std::string> assets;
+	std::vector<std::string> keys;
+	std::vector<std::string> values;
+
+	void add(const std::string& asset, const AssetRegistryData& registry);
+
+	// Assets with a tag Key == Value, in the order they were added
+	const std::vector<uint32_t>& find(const std::string& key, const std::string& value) const;
+	// Distinct values of a key with the number of assets carrying each one
+	std::vector<std::pair<std::string, size_t>> valuesOf(const std::string& key) const;
+
+private:
+	std::unordered_map<std::string, uint32_t> keyIds;
+	std::unordered_map<std::string, uint32_t> valueIds;
+	std::vector<std::unordered_map<uint32_t, std::vector<uint32_t>>> postings; // [keyId][valueId]
+
+	static uint32_t intern(const std::string& text, std::vector<std::string>& table, std::unordered_map<std::string, uint32_t>& ids);
+};
+
+uint32_t AssetTagIndex::intern(const std::string& text, std::vector<std::string>& table, std::unordered_map<std::string, uint32_t>& ids) {
+	auto it = ids.find(text);
+	if (it != ids.end()) {
+		return it->second;
+	}
+	uint32_t id = static_cast<uint32_t>(table.size());
+	table.push_back(text);
+	ids.emplace(text, id);
+	return id;
+}
+
+void AssetTagIndex::add(const std::string& asset, const AssetRegistryData& registry) {
+	uint32_t assetId = static_cast<uint32_t>(assets.size());
+	assets.push_back(asset);
+
+	// Map the asset's local key table to project-wide ids once
+	std::vector<uint32_t> localKeys(registry.Keys.size());
+	for (size_t k = 0; k < registry.Keys.size(); ++k) {
+		localKeys[k] = intern(registry.Keys[k], keys, keyIds);
+	}
+	if (postings.size() < keys.size()) {
+		postings.resize(keys.size());
+	}
+
+	for (const AssetRegistryEntry& entry : registry.data) {
+		for (const Tag& tag : entry.Tags) {
+			uint32_t valueId = intern(tag.Value, values, valueIds);
+			std::vector<uint32_t>& list = postings[localKeys[tag.KeyId]][valueId];
+			if (list.empty() || list.back() != assetId) {
+				list.push_back(assetId);
+			}
+		}
+	}
+}
+
+const std::vector<uint32_t>& AssetTagIndex::find(const std::string& key, const std::string& value) const {
+	static const std::vector<uint32_t> none;
+	auto keyIt = keyIds.find(key);
+	auto valueIt = valueIds.find(value);
+	if (keyIt == keyIds.end() || valueIt == valueIds.end()) {
+		return none;
+	}
+	const auto& byValue = postings[keyIt->second];
+	auto it = byValue.find(valueIt->second);
+	return it != byValue.end() ? it->second : none;
+}
+
+std::vector<std::pair<std::string, size_t>> AssetTagIndex::valuesOf(const std::string& key) const {
+	std::vector<std::pair<std::string, size_t>> result;
+	auto keyIt = keyIds.find(key);
+	if (keyIt == keyIds.end()) {
+		return result;
+	}
+	for (const auto& entry : postings[keyIt->second]) {
+		result.push_back({ values[entry.first], entry.second.size() });
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+// Streams a thumbnail's image bytes from an asset file to out through a fixed-size buffer
+bool copyThumbnailImage(std::istream& in, const Thumbnail& thumbnail, std::ostream& out) {
+	char buffer[64 * 1024];
+	in.clear();
+	in.seekg(thumbnail.ImageDataOffset);
+	for (int64_t left = thumbnail.ImageSizeData; left > 0;) {
+		std::streamsize chunk = static_cast<std::streamsize>(std::min<int64_t>(left, sizeof(buffer)));
+		if (!in.read(buffer, chunk) || !out.write(buffer, chunk)) {
+			return false;
+		}
+		left -= chunk;
+	}
+	return true;
+}
+
+// True when a name taken from a package can be used as a relative output path: '/'-separated
+// segments (only when allowSeparators) that are not empty, "." or "..", with no backslash,
+// drive colon or NUL that could point the path outside the output directory
+bool isSafeRelativePath(const std::string& path, bool allowSeparators) {
+	for (char c : path) {
+		if (c == '\\' || c == ':' || c == '\0' || (c == '/' && !allowSeparators)) {
+			return false;
+		}
+	}
+	size_t begin = 0;
+	while (begin <= path.size()) {
+		size_t end = path.find('/', begin);
+		if (end == std::string::npos) {
+			end = path.size();
+		}
+		std::string segment = path.substr(begin, end - begin);
+		if (segment.empty() || segment == "." || segment == "..") {
+			return false;
+		}
+		begin = end + 1;
+	}
+	return true;
+}
+
+// True when path, once normalized, is root itself or lies below it
+bool isWithinDirectory(const std::filesystem::path& root, const std::filesystem::path& path) {
+	std::filesystem::path relative = path.lexically_normal().lexically_relative(root.lexically_normal());
+	return !relative.empty() && *relative.begin() != ".." && !relative.is_absolute();
+}
+
+// Read-write memory mapping of a whole file
+class MappedFile {
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile() { close(); }
+
+	bool open(const std::string& path);
+	bool flush(size_t offset, size_t size);
+	void close();
+
+	uint8_t* data() { return data_; }
+	size_t size() const { return size_; }
+
+private:
+	uint8_t* data_ = nullptr;
+	size_t size_ = 0;
+#ifdef _WIN32
+	HANDLE file_ = INVALID_HANDLE_VALUE;
+	HANDLE mapping_ = nullptr;
+#else
+	int fd_ = -1;
+#endif
+};
+
+#ifdef _WIN32
+bool MappedFile::open(const std::string& path) {
+	close();
+	file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file_ == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file_, &fileSize) || fileSize.QuadPart == 0) {
+		close();
+		return false;
+	}
+	mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+	if (mapping_ == nullptr) {
+		close();
+		return false;
+	}
+	data_ = static_cast<uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, 0));
+	if (data_ == nullptr) {
+		close();
+		return false;
+	}
+	size_ = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+}
+
+bool MappedFile::flush(size_t offset, size_t size) {
+	return data_ != nullptr && FlushViewOfFile(data_ + offset, size) != 0;
+}
+
+void MappedFile::close() {
+	if (data_ != nullptr) {
+		UnmapViewOfFile(data_);
+	}
+	if (mapping_ != nullptr) {
+		CloseHandle(mapping_);
+	}
+	if (file_ != INVALID_HANDLE_VALUE) {
+		CloseHandle(file_);
+	}
+	data_ = nullptr;
+	size_ = 0;
+	mapping_ = nullptr;
+	file_ = INVALID_HANDLE_VALUE;
+}
+#else
+bool MappedFile::open(const std::string& path) {
+	close();
+	fd_ = ::open(path.c_str(), O_RDWR);
+	if (fd_ < 0) {
+		return false;
+	}
+	struct stat info;
+	if (fstat(fd_, &info) != 0 || info.st_size == 0) {
+		close();
+		return false;
+	}
+	void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+	if (mapped == MAP_FAILED) {
+		close();
+		return false;
+	}
+	data_ = static_cast<uint8_t*>(mapped);
+	size_ = static_cast<size_t>(info.st_size);
+	return true;
+}
+
+bool MappedFile::flush(size_t offset, size_t size) {
+	if (data_ == nullptr) {
+		return false;
+	}
+	// msync needs a page-aligned start
+	size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	size_t start = offset - offset % page;
+	return msync(data_ + start, offset + size - start, MS_SYNC) == 0;
+}
+
+void MappedFile::close() {
+	if (data_ != nullptr) {
+		munmap(data_, size_);
+	}
+	if (fd_ >= 0) {
+		::close(fd_);
+	}
+	data_ = nullptr;
+	size_ = 0;
+	fd_ = -1;
+}
+#endif
+
+// Edits fixed-size property values in place. Offsets come from Property::valueOffset of a
+// parse of the same file; every write first checks that the bytes still hold the value
+// that was decoded, so a stale parse cannot corrupt the asset. Only touched pages are written.
+class PackagePatcher {
+public:
+	// Copies source to target (unless they are the same file) and maps target for writing
+	bool open(const std::string& source, const std::string& target);
+	void close() { file_.close(); }
+
+	bool setBool(const UassetData::Export::Property& property, bool value);
+	bool setInt(const UassetData::Export::Property& property, int32_t value);
+	bool setFloat(const UassetData::Export::Property& property, float value);
+	bool setGuid(const UassetData::Export::Property& property, const std::string& value);
+
+	// Applies a value given as text, converted according to the property's type
+	bool set(const UassetData::Export::Property& property, const std::string& value);
+
+	size_t bytesWritten() const { return bytesWritten_; }
+
+private:
+	bool write(const UassetData::Export::Property& property, const void* expected, const void* value, uint32_t size);
+
+	MappedFile file_;
+	size_t bytesWritten_ = 0;
+};
+
+bool PackagePatcher::open(const std::string& source, const std::string& target) {
+	std::error_code ec;
+	if (!std::filesystem::equivalent(source, target, ec)) {
+		std::filesystem::copy_file(source, target, std::filesystem::copy_options::overwrite_existing, ec);
+		if (ec) {
+			std::cerr << "Failed to copy " << source << " to " << target << ": " << ec.message() << std::endl;
+			return false;
+		}
+	}
+	if (!file_.open(target)) {
+		std::cerr << "Failed to map " << target << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool PackagePatcher::write(const UassetData::Export::Property& property, const void* expected, const void* value, uint32_t size) {
+	if (property.valueOffset < 0 || property.valueSize != size) {
+		std::cerr << "Property " << property.PropertyName << " has no patchable value" << std::endl;
+		return false;
+	}
+	size_t offset = static_cast<size_t>(property.valueOffset);
+	if (file_.data() == nullptr || offset > file_.size() || size > file_.size() - offset) {
+		std::cerr << "Property " << property.PropertyName << " lies outside the file" << std::endl;
+		return false;
+	}
+	if (std::memcmp(file_.data() + offset, expected, size) != 0) {
+		std::cerr << "Property " << property.PropertyName << " changed since it was parsed" << std::endl;
+		return false;
+	}
+	std::memcpy(file_.data() + offset, value, size);
+	bytesWritten_ += size;
+	return file_.flush(offset, size);
+}
+
+bool PackagePatcher::setBool(const UassetData::Export::Property& property, bool value) {
+	uint8_t expected = property.boolValue ? 1 : 0;
+	uint8_t byte = value ? 1 : 0;
+	return property.PropertyType == "bool" && write(property, &expected, &byte, 1);
+}
+
+bool PackagePatcher::setInt(const UassetData::Export::Property& property, int32_t value) {
+	return property.PropertyType == "int" && write(property, &property.intValue, &value, 4);
+}
+
+bool PackagePatcher::setFloat(const UassetData::Export::Property& property, float value) {
+	return property.PropertyType == "float" && write(property, &property.floatValue, &value, 4);
+}
+
+bool PackagePatcher::setGuid(const UassetData::Export::Property& property, const std::string& value) {
+	uint8_t expected[16];
+	uint8_t guid[16];
+	if (!guidStringToBytes(property.stringValue, expected) || !guidStringToBytes(value, guid)) {
+		std::cerr << "Invalid GUID " << value << std::endl;
+		return false;
+	}
+	return write(property, expected, guid, 16);
+}
+
+bool PackagePatcher::set(const UassetData::Export::Property& property, const std::string& value) {
+	try {
+		if (property.PropertyType == "bool") {
+			if (value == "1" || value == "true" || value == "True") {
+				return setBool(property, true);
+			}
+			if (value == "0" || value == "false" || value == "False") {
+				return setBool(property, false);
+			}
+			throw std::invalid_argument(value);
+		}
+		if (property.PropertyType == "int") {
+			return setInt(property, std::stoi(value));
+		}
+		if (property.PropertyType == "float") {
+			return setFloat(property, std::stof(value));
+		}
+		// GUIDs are the only string values with a fixed size
+		if (property.PropertyType == "FString" && property.valueSize == 16) {
+			return setGuid(property, value);
+		}
+		std::cerr << "Property " << property.PropertyName << " has an unsupported property type (" << property.PropertyType << ")" << std::endl;
+		return false;
+	}
+	catch (const std::exception&) {
+		std::cerr << "Invalid value " << value << " for " << property.PropertyType << " property " << property.PropertyName << std::endl;
+		return false;
+	}
+}
+
+// Reads the summary of every asset below root in parallel and builds the dependency graph
+DependencyGraph buildDependencyGraph(const std::vector<std::string>& files) {
+	std::vector<PackageDependencies> dependencies(files.size());
+	parallelForEach<PackageReader>(files.size(), [&](PackageReader& reader, size_t i) {
+		Uasset& uasset = reader.uasset;
+		uasset.options.readThumbnails = false;
+		std::vector<uint8_t>& bytes = reader.bytes;
+		try {
+			if (loadPackageHeader(files[i], uasset, bytes)) {
+				dependencies[i] = collectPackageDependencies(files[i], uasset);
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+		}
+	});
+
+	DependencyGraph graph;
+	graph.build(dependencies);
+	return graph;
+}
+
+// Lower-cased copy of a package's name table laid out as one buffer ("name\nname\n...") so a
+// pattern can be matched against every name with a single scan. Names are matched
+// case-insensitively, as the engine compares them.
+class NameScanner {
+public:
+	explicit NameScanner(const std::vector<UassetData::Name>& names);
+
+	// Indices of the names containing pattern (already lower-cased), in table order
+	std::vector<uint32_t> find(const std::string& pattern) const;
+
+	static std::string lower(const std::string& text);
+
+private:
+	std::string buffer_;
+	std::vector<uint32_t> starts_;   // buffer offset of each name; starts_.back() is the buffer size
+};
+
+std::string NameScanner::lower(const std::string& text) {
+	std::string result(text);
+	for (char& c : result) {
+		if (c >= 'A' && c <= 'Z') {
+			c = static_cast<char>(c - 'A' + 'a');
+		}
+	}
+	return result;
+}
+
+NameScanner::NameScanner(const std::vector<UassetData::Name>& names) {
+	size_t total = 0;
+	for (const UassetData::Name& name : names) {
+		total += name.Name.size() + 1;
+	}
+	buffer_.reserve(total);
+	starts_.reserve(names.size() + 1);
+	for (const UassetData::Name& name : names) {
+		starts_.push_back(static_cast<uint32_t>(buffer_.size()));
+		buffer_ += lower(name.Name);
+		buffer_ += '\n';
+	}
+	starts_.push_back(static_cast<uint32_t>(buffer_.size()));
+}
+
+// Calls onMatch(offset) for each occurrence of pattern in text. With SSE2 the first and last
+// pattern bytes are compared against 16 positions at once and only positions where both match
+// are verified with memcmp.
+template <typename Fn>
+static void scanSubstring(const char* text, size_t size, const std::string& pattern, Fn onMatch) {
+	const size_t n = pattern.size();
+	if (n == 0 || n > size) {
+		return;
+	}
+	size_t i = 0;
+#ifdef UEPARSER_SSE2
+	const __m128i first = _mm_set1_epi8(pattern[0]);
+	const __m128i last = _mm_set1_epi8(pattern[n - 1]);
+	for (; i + n - 1 + 16 <= size; i += 16) {
+		__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+		__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + n - 1));
+		uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+			_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+		while (mask != 0) {
+			uint32_t bit = 0;
+			while (!(mask & (1u << bit))) {
+				++bit;
+			}
+			if (std::memcmp(text + i + bit + 1, pattern.data() + 1, n - 1) == 0) {
+				onMatch(i + bit);
+			}
+			mask &= mask - 1;
+		}
+	}
+#endif
+	for (; i + n <= size; ++i) {
+		if (text[i] == pattern[0] && std::memcmp(text + i, pattern.data(), n) == 0) {
+			onMatch(i);
+		}
+	}
+}
+
+std::vector<uint32_t> NameScanner::find(const std::string& pattern) const {
+	std::vector<uint32_t> result;
+	scanSubstring(buffer_.data(), buffer_.size(), pattern, [&](size_t offset) {
+		uint32_t index = static_cast<uint32_t>(std::upper_bound(starts_.begin(), starts_.end(), offset) - starts_.begin()) - 1;
+		if (result.empty() || result.back() != index) {
+			result.push_back(index);
+		}
+	});
+	return result;
+}
+
+// Bloom filter over one package's lower-cased names. Whole names answer exact queries; every
+// trigram of every name is added too so a substring pattern of three or more characters can
+// be rejected when one of its trigrams is missing.
+class NameBloomFilter {
+public:
+	static const uint32_t HashCount = 4;
+
+	std::vector<uint64_t> bits;
+
+	void build(const std::vector<UassetData::Name>& names);
+	bool mayContainName(const std::string& lowered) const;
+	bool mayContainSubstring(const std::string& lowered) const;
+
+private:
+	static uint64_t hash(const char* text, size_t size);
+	void insert(uint64_t h);
+	bool test(uint64_t h) const;
+};
+
+uint64_t NameBloomFilter::hash(const char* text, size_t size) {
+	uint64_t h = 14695981039346656037ULL;   // FNV-1a
+	for (size_t i = 0; i < size; ++i) {
+		h = (h ^ static_cast<uint8_t>(text[i])) * 1099511628211ULL;
+	}
+	return h;
+}
+
+void NameBloomFilter::insert(uint64_t h) {
+	const uint64_t bitCount = bits.size() * 64;
+	uint64_t step = (h >> 32) | 1;
+	for (uint32_t k = 0; k < HashCount; ++k, h += step) {
+		uint64_t bit = h % bitCount;
+		bits[bit / 64] |= 1ULL << (bit % 64);
+	}
+}
+
+bool NameBloomFilter::test(uint64_t h) const {
+	if (bits.empty()) {
+		return true;
+	}
+	const uint64_t bitCount = bits.size() * 64;
+	uint64_t step = (h >> 32) | 1;
+	for (uint32_t k = 0; k < HashCount; ++k, h += step) {
+		uint64_t bit = h % bitCount;
+		if (!(bits[bit / 64] & (1ULL << (bit % 64)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void NameBloomFilter::build(const std::vector<UassetData::Name>& names) {
+	size_t items = 0;
+	for (const UassetData::Name& name : names) {
+		items += 1 + (name.Name.size() > 2 ? name.Name.size() - 2 : 0);
+	}
+	// About 8 bits per item keeps false positives near 3% with four hashes
+	bits.assign(std::max<size_t>(1, (items * 8 + 63) / 64), 0);
+	for (const UassetData::Name& name : names) {
+		std::string lowered = NameScanner::lower(name.Name);
+		insert(hash(lowered.data(), lowered.size()));
+		for (size_t i = 0; i + 3 <= lowered.size(); ++i) {
+			insert(hash(lowered.data() + i, 3));
+		}
+	}
+}
+
+bool NameBloomFilter::mayContainName(const std::string& lowered) const {
+	return test(hash(lowered.data(), lowered.size()));
+}
+
+bool NameBloomFilter::mayContainSubstring(const std::string& lowered) const {
+	for (size_t i = 0; i + 3 <= lowered.size(); ++i) {
+		if (!test(hash(lowered.data() + i, 3))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Bloom filters of every package below a content directory, saved next to the assets so repeat
+// searches can skip packages without opening them. An entry is reused while the file's size and
+// modification time are unchanged.
+class NameSearchIndex {
+public:
+	struct Entry {
+		uint64_t fileSize = 0;
+		int64_t modifiedTime = 0;
+		NameBloomFilter filter;
+	};
+
+	std::unordered_map<std::string, Entry> entries;
+
+	bool load(const std::string& path);
+	bool save(const std::string& path) const;
+
+private:
+	static const uint32_t Magic = 0x4250454E;   // "NEPB"
+	static const uint32_t Version = 1;
+};
+
+bool NameSearchIndex::load(const std::string& path) {
+	entries.clear();
+	std::ifstream in(path, std::ios::binary);
+	if (!in) {
+		return false;
+	}
+	auto read = [&](void* value, size_t size) {
+		return static_cast<bool>(in.read(reinterpret_cast<char*>(value), size));
+	};
+	uint32_t magic = 0, version = 0, count = 0;
+	if (!read(&magic, 4) || !read(&version, 4) || !read(&count, 4) || magic != Magic || version != Version) {
+		return false;
+	}
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t pathSize = 0, words = 0;
+		std::string file;
+		Entry entry;
+		if (!read(&pathSize, 4) || pathSize > 4096) {
+			entries.clear();
+			return false;
+		}
+		file.resize(pathSize);
+		if (!read(&file[0], pathSize) || !read(&entry.fileSize, 8) || !read(&entry.modifiedTime, 8) || !read(&words, 4) || words > (1u << 24)) {
+			entries.clear();
+			return false;
+		}
+		entry.filter.bits.resize(words);
+		if (!read(entry.filter.bits.data(), words * sizeof(uint64_t))) {
+			entries.clear();
+			return false;
+		}
+		entries.emplace(std::move(file), std::move(entry));
+	}
+	return true;
+}
+
+bool NameSearchIndex::save(const std::string& path) const {
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		return false;
+	}
+	auto write = [&](const void* value, size_t size) {
+		out.write(reinterpret_cast<const char*>(value), size);
+	};
+	uint32_t header[3] = { Magic, Version, static_cast<uint32_t>(entries.size()) };
+	write(header, sizeof(header));
+	for (const auto& item : entries) {
+		uint32_t pathSize = static_cast<uint32_t>(item.first.size());
+		uint32_t words = static_cast<uint32_t>(item.second.filter.bits.size());
+		write(&pathSize, 4);
+		write(item.first.data(), pathSize);
+		write(&item.second.fileSize, 8);
+		write(&item.second.modifiedTime, 8);
+		write(&words, 4);
+		write(item.second.filter.bits.data(), words * sizeof(uint64_t));
+	}
+	return static_cast<bool>(out);
+}
+
+// Size and modification time of a file, used to tell whether cached results are still current
+bool fileStamp(const std::string& path, uint64_t& size, int64_t& modifiedTime) {
+	std::error_code error;
+	size = std::filesystem::file_size(path, error);
+	if (error) {
+		return false;
+	}
+	modifiedTime = static_cast<int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+	return !error;
+}
+
+// Fully parsed packages kept warm for the server. Entries are shared and never modified once
+// published; a lookup reparses when the file's size or modification time changed and the least
+// recently used package is dropped when the cache is full.
+class ParseCache {
+public:
+	struct Package {
+		Uasset uasset;
+		uint64_t fileSize = 0;
+		int64_t modifiedTime = 0;
+
+		const std::string& document() const;
+
+	private:
+		mutable std::once_flag documentOnce;
+		mutable std::string documentText;
+	};
+
+	explicit ParseCache(size_t capacity) : capacity_(std::max<size_t>(1, capacity)) {}
+
+	std::shared_ptr<const Package> get(const std::string& path, std::string& error);
+
+	std::atomic<size_t> hits{ 0 };
+	std::atomic<size_t> misses{ 0 };
+	size_t size() const;
+
+private:
+	typedef std::list<std::string> Order;
+	struct Slot {
+		std::shared_ptr<const Package> package;
+		Order::iterator position;
+	};
+
+	size_t capacity_;
+	mutable std::mutex mutex_;
+	Order order_;   // most recently used first
+	std::unordered_map<std::string, Slot> slots_;
+};
+
+const std::string& ParseCache::Package::document() const {
+	std::call_once(documentOnce, [this] {
+		documentText = uasset.toJson().dump();
+	});
+	return documentText;
+}
+
+size_t ParseCache::size() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return slots_.size();
+}
+
+std::shared_ptr<const ParseCache::Package> ParseCache::get(const std::string& path, std::string& error) {
+	uint64_t fileSize = 0;
+	int64_t modifiedTime = 0;
+	if (!fileStamp(path, fileSize, modifiedTime)) {
+		error = "cannot stat " + path;
+		return nullptr;
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto found = slots_.find(path);
+		if (found != slots_.end() && found->second.package->fileSize == fileSize && found->second.package->modifiedTime == modifiedTime) {
+			order_.splice(order_.begin(), order_, found->second.position);
+			++hits;
+			return found->second.package;
+		}
+	}
+
+	// Parse outside the lock so other requests keep being served
+	++misses;
+	std::vector<uint8_t> bytes;
+	auto package = std::make_shared<Package>();
+	package->fileSize = fileSize;
+	package->modifiedTime = modifiedTime;
+	package->uasset.options.verbose = false;
+	package->uasset.options.readThumbnails = false;
+	if (!readFileBytes(path, bytes) || !package->uasset.parse(bytes)) {
+		error = "failed to parse " + path;
+		return nullptr;
+	}
+	// Decode the lazy sections now; the buffer is released and the package is shared read-only
+	package->uasset.softObjectPaths();
+	package->uasset.softPackageReferences();
+	package->uasset.searchableNames();
+	package->uasset.release();
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto found = slots_.find(path);
+	if (found != slots_.end()) {
+		order_.erase(found->second.position);
+		slots_.erase(found);
+	}
+	order_.push_front(path);
+	slots_[path] = { package, order_.begin() };
+	while (slots_.size() > capacity_) {
+		slots_.erase(order_.back());
+		order_.pop_back();
+	}
+	return package;
+}
+
+#ifndef _WIN32
+// Line-oriented request server on a Unix domain socket. Each request line is answered with one
+// line of JSON, {"ok":true,"result":...} or {"ok":false,"error":"..."}:
+//   header <Path>                 package summary
+//   exports <Path>                export table
+//   properties <ExportIndex> <Path>   decoded properties of export N (1-based)
+//   json <Path>                   the full document printed by the default mode
+//   stats                         cache counters
+//   shutdown                      stop the server and close every connection
+// The accepting thread polls all connections and queues one complete request line per connection
+// at a time; a fixed pool of worker threads answers them. Idle connections hold no worker, so any
+// number of clients can stay connected, and replies on one connection keep the request order.
+class ParseServer {
+public:
+	ParseServer(const std::string& socketPath, size_t threads, size_t cacheCapacity)
+		: socketPath_(socketPath), threads_(std::max<size_t>(1, threads)), cache_(cacheCapacity) {}
+
+	bool run();
+	std::string respond(const std::string& request);
+
+private:
+	static constexpr size_t MaxRequestBytes = 64 * 1024;   // longest request line accepted
+	static constexpr int SendTimeoutMs = 10000;            // a client that stops reading is dropped
+
+	struct Connection {
+		std::string pending;   // bytes received after the last queued request line
+		bool busy = false;     // a worker is answering this connection's current request
+	};
+	struct Job {
+		int client = -1;
+		std::string request;
+	};
+
+	bool dispatch(int client, Connection& connection);
+	bool reply(int client, const std::string& text);
+	void worker();
+
+	std::string socketPath_;
+	size_t threads_;
+	ParseCache cache_;
+	int listener_ = -1;
+	int wake_[2] = { -1, -1 };   // workers write a byte here when they finish a request
+	std::atomic<bool> stopping_{ false };
+	std::mutex queueMutex_;
+	std::condition_variable queueReady_;
+	std::deque<Job> jobs_;
+	std::vector<std::pair<int, bool>> finished_;   // client and whether its reply was sent
+};
+
+bool ParseServer::run() {
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (socketPath_.size() >= sizeof(address.sun_path)) {
+		std::cerr << "Socket path too long: " << socketPath_ << std::endl;
+		return false;
+	}
+	std::strcpy(address.sun_path, socketPath_.c_str());
+	listener_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listener_ < 0) {
+		std::cerr << "socket() failed" << std::endl;
+		return false;
+	}
+	::unlink(socketPath_.c_str());
+	if (::bind(listener_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener_, 64) != 0) {
+		std::cerr << "Cannot listen on " << socketPath_ << std::endl;
+		::close(listener_);
+		return false;
+	}
+	if (::pipe(wake_) != 0) {
+		std::cerr << "pipe() failed" << std::endl;
+		::close(listener_);
+		return false;
+	}
+	::fcntl(wake_[0], F_SETFL, O_NONBLOCK);
+	::fcntl(wake_[1], F_SETFL, O_NONBLOCK);
+
+	std::vector<std::thread> workers;
+	for (size_t t = 0; t < threads_; ++t) {
+		workers.emplace_back(&ParseServer::worker, this);
+	}
+	std::cout << "Listening on " << socketPath_ << " with " << threads_ << " threads" << std::endl;
+
+	std::unordered_map<int, Connection> connections;
+	std::vector<pollfd> fds;
+	std::vector<std::pair<int, bool>> finished;
+	char buffer[4096];
+	auto disconnect = [&](int client) {
+		connections.erase(client);
+		::close(client);
+	};
+	while (!stopping_) {
+		// Busy connections are not read until their reply is out, which bounds what each one buffers
+		fds.clear();
+		fds.push_back({ wake_[0], POLLIN, 0 });
+		fds.push_back({ listener_, POLLIN, 0 });
+		for (const auto& entry : connections) {
+			if (!entry.second.busy) {
+				fds.push_back({ entry.first, POLLIN, 0 });
+			}
+		}
+		if (::poll(fds.data(), fds.size(), -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+
+		if (fds[0].revents != 0) {
+			while (::read(wake_[0], buffer, sizeof(buffer)) > 0) {
+			}
+			{
+				std::lock_guard<std::mutex> lock(queueMutex_);
+				finished.swap(finished_);
+			}
+			for (const auto& done : finished) {
+				auto it = connections.find(done.first);
+				it->second.busy = false;
+				if (!done.second || !dispatch(done.first, it->second)) {
+					disconnect(done.first);
+				}
+			}
+			finished.clear();
+			if (stopping_) {
+				break;
+			}
+		}
+
+		if (fds[1].revents & POLLIN) {
+			int client = ::accept(listener_, nullptr, nullptr);
+			if (client >= 0) {
+				::fcntl(client, F_SETFL, O_NONBLOCK);
+				connections[client];
+			}
+			else if (errno != EINTR && errno != EAGAIN && errno != ECONNABORTED) {
+				break;
+			}
+		}
+
+		for (size_t f = 2; f < fds.size(); ++f) {
+			if (fds[f].revents == 0) {
+				continue;
+			}
+			int client = fds[f].fd;
+			ssize_t received = ::recv(client, buffer, sizeof(buffer), 0);
+			if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+				continue;
+			}
+			if (received <= 0) {
+				disconnect(client);
+				continue;
+			}
+			Connection& connection = connections[client];
+			connection.pending.append(buffer, static_cast<size_t>(received));
+			if (!dispatch(client, connection)) {
+				disconnect(client);
+			}
+		}
+	}
+
+	// Requests still queued are dropped; workers finish the one they hold before exiting
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		stopping_ = true;
+		jobs_.clear();
+	}
+	queueReady_.notify_all();
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+	for (const auto& entry : connections) {
+		::close(entry.first);
+	}
+	::close(wake_[0]);
+	::close(wake_[1]);
+	::close(listener_);
+	::unlink(socketPath_.c_str());
+	return true;
+}
+
+// Queues the connection's next complete request line, if it has one. Returns false when the
+// connection should be closed because a request line grew past MaxRequestBytes.
+bool ParseServer::dispatch(int client, Connection& connection) {
+	size_t newline = connection.pending.find('\n');
+	if (newline == std::string::npos) {
+		return connection.pending.size() <= MaxRequestBytes;
+	}
+	std::string request = connection.pending.substr(0, newline);
+	connection.pending.erase(0, newline + 1);
+	if (!request.empty() && request.back() == '\r') {
+		request.pop_back();
+	}
+	connection.busy = true;
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		jobs_.push_back({ client, std::move(request) });
+	}
+	queueReady_.notify_one();
+	return true;
+}
+
+// Sends a whole reply on a non-blocking socket, waiting up to SendTimeoutMs whenever it is full
+bool ParseServer::reply(int client, const std::string& text) {
+	for (size_t sent = 0; sent < text.size();) {
+		ssize_t written = ::send(client, text.data() + sent, text.size() - sent, MSG_NOSIGNAL);
+		if (written > 0) {
+			sent += static_cast<size_t>(written);
+			continue;
+		}
+		if (written < 0 && errno == EINTR) {
+			continue;
+		}
+		if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			pollfd writable = { client, POLLOUT, 0 };
+			if (::poll(&writable, 1, SendTimeoutMs) > 0) {
+				continue;
+			}
+		}
+		return false;
+	}
+	return true;
+}
+
+void ParseServer::worker() {
+	while (true) {
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			queueReady_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+			if (stopping_) {
+				return;
+			}
+			job = std::move(jobs_.front());
+			jobs_.pop_front();
+		}
+		bool sent = reply(job.client, respond(job.request) + "\n");
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			finished_.emplace_back(job.client, sent);
+		}
+		char signal = 1;
+		if (::write(wake_[1], &signal, 1) < 0) {
+			// The pipe is full, so the accepting thread is already due to wake
+		}
+	}
+}
+
+std::string ParseServer::respond(const std::string& request) {
+	auto failure = [](const std::string& message) {
+		return json({ {"ok", false}, {"error", message} }).dump();
+	};
+	size_t space = request.find(' ');
+	std::string command = request.substr(0, space);
+	std::string argument = space == std::string::npos ? "" : request.substr(space + 1);
+
+	if (command == "stats") {
+		return json({ {"ok", true}, {"result", { {"cached", cache_.size()}, {"hits", cache_.hits.load()}, {"misses", cache_.misses.load()} }} }).dump();
+	}
+	if (command == "shutdown") {
+		// The accepting thread sees this once the reply is sent and closes every connection
+		stopping_ = true;
+		return json({ {"ok", true} }).dump();
+	}
+
+	if (command != "header" && command != "exports" && command != "properties" && command != "json") {
+		return failure("unknown command " + command);
+	}
+	int32_t exportIndex = 0;
+	if (command == "properties") {
+		size_t split = argument.find(' ');
+		if (split == std::string::npos) {
+			return failure("usage: properties <ExportIndex> <Path>");
+		}
+		exportIndex = std::atoi(argument.substr(0, split).c_str());
+		argument = argument.substr(split + 1);
+	}
+	if (argument.empty()) {
+		return failure("missing path");
+	}
+
+	std::string error;
+	std::shared_ptr<const ParseCache::Package> package = cache_.get(argument, error);
+	if (!package) {
+		return failure(error);
+	}
+	const Uasset& uasset = package->uasset;
+	if (command == "json") {
+		// The cached document is spliced in rather than re-serialized
+		return "{\"ok\":true,\"result\":" + package->document() + "}";
+	}
+	json result;
+	if (command == "header") {
+		result = uasset.headerJson();
+	}
+	else if (command == "exports") {
+		result = json::array();
+		for (const UassetData::Export& exportData : uasset.data.exports) {
+			result.push_back(uasset.exportJson(exportData));
+		}
+	}
+	else {
+		if (exportIndex <= 0 || static_cast<size_t>(exportIndex) > uasset.data.exports.size()) {
+			return failure("export index out of range");
+		}
+		result = json::array();
+		for (const UassetData::Export::Property& property : uasset.data.exports[exportIndex - 1].properties) {
+			result.push_back({
+				{"name", property.PropertyName},
+				{"type", property.PropertyType},
+				{"value", propertyValueString(property)},
+				{"valueOffset", property.valueOffset}
+				});
+		}
+	}
+	return json({ {"ok", true}, {"result", result} }).dump();
+}
+#endif
+
+// What the project index keeps of one package: its header-level names, dependencies and the
+// classes of its exports
+struct PackageSummary {
+	PackageDependencies dependencies;
+	std::vector<std::string> names;
+	std::vector<std::string> classes;
+};
+
+bool summarizePackage(const std::string& path, PackageSummary& summary) {
+	Uasset uasset;
+	uasset.options.readThumbnails = false;
+	std::vector<uint8_t> bytes;
+	try {
+		if (!loadPackageHeader(path, uasset, bytes)) {
+			return false;
+		}
+		summary.dependencies = collectPackageDependencies(path, uasset);
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+	summary.names.clear();
+	for (const UassetData::Name& name : uasset.data.names) {
+		summary.names.push_back(NameScanner::lower(name.Name));
+	}
+	summary.classes.clear();
+	for (const UassetData::ObjectGraph::Object& object : uasset.data.objectGraph.exports) {
+		summary.classes.push_back(object.className);
+	}
+	for (std::vector<std::string>* list : { &summary.names, &summary.classes }) {
+		std::sort(list->begin(), list->end());
+		list->erase(std::unique(list->begin(), list->end()), list->end());
+	}
+	return true;
+}
+
+// Name, dependency and class indexes over a set of packages that can be updated one file at a
+// time. Strings are interned; each index maps a string id to the sorted ids of the files using
+// it, and every file remembers what it contributed so an update only touches those postings.
+class ProjectIndex {
+public:
+	void update(const std::string& path, const PackageSummary& summary);
+	void remove(const std::string& path);
+
+	std::vector<std::string> filesWithName(const std::string& name) const;
+	std::vector<std::string> filesWithClass(const std::string& className) const;
+	std::vector<std::string> dependents(const std::string& packageName) const;
+	size_t fileCount() const { return fileIds_.size(); }
+
+private:
+	struct StringTable {
+		std::vector<std::string> strings;
+		std::unordered_map<std::string, uint32_t> ids;
+		std::vector<std::vector<uint32_t>> postings;   // string id -> sorted file ids
+
+		uint32_t intern(const std::string& text);
+		const std::vector<uint32_t>* find(const std::string& text) const;
+	};
+	struct FileEntry {
+		std::string path;
+		std::vector<uint32_t> names;
+		std::vector<uint32_t> classes;
+		std::vector<uint32_t> packages;   // hard and soft dependencies
+	};
+
+	StringTable names_;
+	StringTable classes_;
+	StringTable packages_;
+	std::vector<FileEntry> files_;
+	std::vector<uint32_t> freeFiles_;
+	std::unordered_map<std::string, uint32_t> fileIds_;
+
+	static void post(StringTable& table, const std::vector<uint32_t>& ids, uint32_t file, bool add);
+	std::vector<std::string> paths(const std::vector<uint32_t>* files) const;
+};
+
+uint32_t ProjectIndex::StringTable::intern(const std::string& text) {
+	auto found = ids.find(text);
+	if (found != ids.end()) {
+		return found->second;
+	}
+	uint32_t id = static_cast<uint32_t>(strings.size());
+	strings.push_back(text);
+	postings.emplace_back();
+	ids.emplace(text, id);
+	return id;
+}
+
+const std::vector<uint32_t>* ProjectIndex::StringTable::find(const std::string& text) const {
+	auto found = ids.find(text);
+	return found != ids.end() ? &postings[found->second] : nullptr;
+}
+
+void ProjectIndex::post(StringTable& table, const std::vector<uint32_t>& ids, uint32_t file, bool add) {
+	for (uint32_t id : ids) {
+		std::vector<uint32_t>& files = table.postings[id];
+		auto position = std::lower_bound(files.begin(), files.end(), file);
+		if (add && (position == files.end() || *position != file)) {
+			files.insert(position, file);
+		}
+		else if (!add && position != files.end() && *position == file) {
+			files.erase(position);
+		}
+	}
+}
+
+void ProjectIndex::update(const std::string& path, const PackageSummary& summary) {
+	uint32_t file;
+	auto found = fileIds_.find(path);
+	if (found != fileIds_.end()) {
+		file = found->second;
+		FileEntry& entry = files_[file];
+		post(names_, entry.names, file, false);
+		post(classes_, entry.classes, file, false);
+		post(packages_, entry.packages, file, false);
+	}
+	else if (!freeFiles_.empty()) {
+		file = freeFiles_.back();
+		freeFiles_.pop_back();
+		fileIds_.emplace(path, file);
+	}
+	else {
+		file = static_cast<uint32_t>(files_.size());
+		files_.emplace_back();
+		fileIds_.emplace(path, file);
+	}
+
+	FileEntry& entry = files_[file];
+	entry.path = path;
+	entry.names.clear();
+	entry.classes.clear();
+	entry.packages.clear();
+	for (const std::string& name : summary.names) {
+		entry.names.push_back(names_.intern(name));
+	}
+	for (const std::string& className : summary.classes) {
+		entry.classes.push_back(classes_.intern(className));
+	}
+	for (const std::vector<std::string>* list : { &summary.dependencies.hard, &summary.dependencies.soft }) {
+		for (const std::string& package : *list) {
+			entry.packages.push_back(packages_.intern(package));
+		}
+	}
+	std::sort(entry.packages.begin(), entry.packages.end());
+	entry.packages.erase(std::unique(entry.packages.begin(), entry.packages.end()), entry.packages.end());
+	post(names_, entry.names, file, true);
+	post(classes_, entry.classes, file, true);
+	post(packages_, entry.packages, file, true);
+}
+
+void ProjectIndex::remove(const std::string& path) {
+	auto found = fileIds_.find(path);
+	if (found == fileIds_.end()) {
+		return;
+	}
+	uint32_t file = found->second;
+	FileEntry& entry = files_[file];
+	post(names_, entry.names, file, false);
+	post(classes_, entry.classes, file, false);
+	post(packages_, entry.packages, file, false);
+	entry = FileEntry();
+	freeFiles_.push_back(file);
+	fileIds_.erase(found);
+}
+
+std::vector<std::string> ProjectIndex::paths(const std::vector<uint32_t>* files) const {
+	std::vector<std::string> result;
+	if (files) {
+		for (uint32_t file : *files) {
+			result.push_back(files_[file].path);
+		}
+	}
+	return result;
+}
+
+std::vector<std::string> ProjectIndex::filesWithName(const std::string& name) const {
+	return paths(names_.find(NameScanner::lower(name)));
+}
+
+std::vector<std::string> ProjectIndex::filesWithClass(const std::string& className) const {
+	return paths(classes_.find(className));
+}
+
+std::vector<std::string> ProjectIndex::dependents(const std::string& packageName) const {
+	return paths(packages_.find(packageName));
+}
+
+#ifdef __linux__
+// Recursive inotify watch on a directory tree. Writes, moves and deletions of package files are
+// reported by path, last event per path winning; directories created later are watched as
+// they appear and the packages already inside them are reported as changed.
+class DirectoryWatcher {
+public:
+	struct Change {
+		std::string path;
+		bool removed;
+		bool directory;   // a directory moved away or deleted: everything below path is gone
+	};
+
+	~DirectoryWatcher();
+
+	bool open(const std::string& root);
+	int fd() const { return fd_; }
+	// Drains pending events. overflowed is set when the kernel queue overflowed and events were lost.
+	std::vector<Change> read(bool& overflowed);
+
+private:
+	void watchTree(const std::string& directory, std::vector<Change>* found);
+	void unwatchTree(const std::string& directory);
+
+	int fd_ = -1;
+	std::unordered_map<int, std::string> directories_;
+};
+
+DirectoryWatcher::~DirectoryWatcher() {
+	if (fd_ >= 0) {
+		::close(fd_);
+	}
+}
+
+bool DirectoryWatcher::open(const std::string& root) {
+	fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd_ < 0) {
+		return false;
+	}
+	std::string directory = root;
+	while (directory.size() > 1 && directory.back() == '/') {
+		directory.pop_back();
+	}
+	watchTree(directory, nullptr);
+	return !directories_.empty();
+}
+
+void DirectoryWatcher::watchTree(const std::string& directory, std::vector<Change>* found) {
+	const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE | IN_DELETE_SELF | IN_MOVE_SELF;
+	int wd = ::inotify_add_watch(fd_, directory.c_str(), mask);
+	if (wd >= 0) {
+		directories_[wd] = directory;
+	}
+	std::error_code ec;
+	for (std::filesystem::recursive_directory_iterator it(directory, ec), end; it != end; it.increment(ec)) {
+		if (ec) {
+			break;
+		}
+		if (it->is_directory(ec)) {
+			wd = ::inotify_add_watch(fd_, it->path().generic_string().c_str(), mask);
+			if (wd >= 0) {
+				directories_[wd] = it->path().generic_string();
+			}
+		}
+		else if (found && isAssetPath(it->path())) {
+			found->push_back({ it->path().generic_string(), false, false });
+		}
+	}
+}
+
+// Drops the watches of a directory and everything below it. A moved directory keeps its
+// watches, which would otherwise go on reporting events under the old path.
+void DirectoryWatcher::unwatchTree(const std::string& directory) {
+	const std::string prefix = directory + "/";
+	for (auto it = directories_.begin(); it != directories_.end();) {
+		if (it->second == directory || it->second.compare(0, prefix.size(), prefix) == 0) {
+			::inotify_rm_watch(fd_, it->first);
+			it = directories_.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+}
+
+std::vector<DirectoryWatcher::Change> DirectoryWatcher::read(bool& overflowed) {
+	std::vector<Change> changes;
+	overflowed = false;
+	alignas(inotify_event) char buffer[64 * 1024];
+	while (true) {
+		ssize_t length = ::read(fd_, buffer, sizeof(buffer));
+		if (length <= 0) {
+			break;
+		}
+		for (char* ptr = buffer; ptr < buffer + length;) {
+			const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+			ptr += sizeof(inotify_event) + event->len;
+			if (event->mask & IN_Q_OVERFLOW) {
+				overflowed = true;
+				continue;
+			}
+			auto directory = directories_.find(event->wd);
+			if (directory == directories_.end()) {
+				continue;
+			}
+			if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+				if (event->mask & IN_MOVE_SELF) {
+					::inotify_rm_watch(fd_, event->wd);
+				}
+				directories_.erase(directory);
+				continue;
+			}
+			if (event->len == 0) {
+				continue;
+			}
+			std::string path = directory->second + "/" + event->name;
+			if (event->mask & IN_ISDIR) {
+				if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+					watchTree(path, &changes);
+				}
+				else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+					unwatchTree(path);
+					changes.push_back({ path, true, true });
+				}
+				continue;
+			}
+			if (!isAssetPath(path)) {
+				continue;
+			}
+			if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+				changes.push_back({ path, false, false });
+			}
+			else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+				changes.push_back({ path, true, false });
+			}
+		}
+	}
+
+	// Keep only the last change of each path
+	std::unordered_map<std::string, size_t> last;
+	for (size_t i = 0; i < changes.size(); ++i) {
+		last[changes[i].path] = i;
+	}
+	std::vector<Change> result;
+	for (size_t i = 0; i < changes.size(); ++i) {
+		if (last[changes[i].path] == i) {
+			result.push_back(changes[i]);
+		}
+	}
+	return result;
+}
+#endif
+
+// Disassembles every Function export of a fully loaded package, in parallel unless the
+// caller is already running one package per thread
+std::vector<KismetFunction> disassembleFunctions(const UassetData& data, const std::vector<uint8_t>& bytes, bool parallel = true) {
+	std::vector<int32_t> functions = filterExportsByClassName(data, "Function");
+	std::vector<KismetFunction> result(functions.size());
+	KismetDisassembler disassembler(data);
+	auto run = [&](size_t i) {
+		result[i] = disassembler.disassemble(bytes, functions[i]);
+	};
+	if (parallel) {
+		parallelFor(functions.size(), run);
+	}
+	else {
+		for (size_t i = 0; i < functions.size(); ++i) {
+			run(i);
+		}
+	}
+	return result;
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Chrome trace-event output for a batch run (chrome://tracing, ui.perfetto.dev). Workers add
+// one file span plus that parse's section and export spans; the per-thread track shows load balance.
+class TraceRecorder {
+public:
+	TraceRecorder() : origin_(std::chrono::steady_clock::now()) {}
+
+	void addFile(const std::string& path, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end,
+		bool parsed, size_t bytes, const std::vector<ParseProfile::Span>& spans) {
+		uint32_t tid = currentThreadId();
+		std::vector<json> events;
+		events.reserve(spans.size() + 1);
+		json file = event(std::filesystem::path(path).filename().string(), "file", tid, begin, end);
+		file["args"] = { {"path", path}, {"parsed", parsed}, {"bytes", bytes} };
+		events.push_back(std::move(file));
+		for (const ParseProfile::Span& span : spans) {
+			const char* category = span.section == ParseProfile::ExportData ? "export" : "section";
+			events.push_back(event(span.name, category, tid, span.begin, span.end));
+		}
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (json& e : events) {
+			events_.push_back(std::move(e));
+		}
+		if (std::find(threads_.begin(), threads_.end(), tid) == threads_.end()) {
+			threads_.push_back(tid);
+		}
+	}
+
+	bool write(const std::string& path) const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		json trace;
+		trace["displayTimeUnit"] = "ms";
+		json& events = trace["traceEvents"] = json::array();
+		for (uint32_t tid : threads_) {
+			events.push_back({ {"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", tid},
+				{"args", { {"name", "worker " + std::to_string(tid)} }} });
+		}
+		for (const json& e : events_) {
+			events.push_back(e);
+		}
+		std::ofstream out(path);
+		out << trace.dump() << std::endl;
+		return static_cast<bool>(out);
+	}
+
+	size_t size() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return events_.size();
+	}
+
+private:
+	std::chrono::steady_clock::time_point origin_;
+	mutable std::mutex mutex_;
+	std::vector<json> events_;
+	std::vector<uint32_t> threads_;
+
+	// Small, stable per-thread ids read better in the viewer than std::thread::id hashes
+	static uint32_t currentThreadId() {
+		static std::atomic<uint32_t> nextId(1);
+		thread_local uint32_t id = nextId++;
+		return id;
+	}
+
+	json event(const std::string& name, const char* category, uint32_t tid,
+		std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end) const {
+		return {
+			{"name", name}, {"cat", category}, {"ph", "X"}, {"pid", 1}, {"tid", tid},
+			{"ts", std::chrono::duration<double, std::micro>(begin - origin_).count()},
+			{"dur", std::chrono::duration<double, std::micro>(end - begin).count()},
+		};
+	}
+};
+
+// Builds synthetic UE5 packages in the layout the parser expects, so parsing can be measured
+// without proprietary content. Every export body carries a configurable mix of the tagged
+// properties the handlers decode (bool, int, object array, Guid struct, Guid map).
+class SyntheticAssetGenerator {
+public:
+	struct Config {
+		uint32_t names = 64;          // total name table entries (extra ones are filler)
+		uint32_t imports = 16;        // extra package imports beyond the three the exports use
+		uint32_t exports = 32;
+		uint32_t properties = 16;     // tagged properties per export
+		uint32_t boolWeight = 4;      // relative share of each property kind
+		uint32_t intWeight = 4;
+		uint32_t arrayWeight = 1;
+		uint32_t structWeight = 1;
+		uint32_t guidWeight = 1;
+		uint32_t arrayLength = 8;     // elements per AllNodes array
+		uint32_t guidsPerMap = 8;     // entries per PropertyGuids map
+		uint32_t thumbnailBytes = 0;  // image payload of the single thumbnail, 0 for none
+		// Malformed shapes kept as fuzz seeds
+		bool paddingTerminator = false;   // end each body with a zero FName instead of None
+		bool outerChain = false;          // make each export the outer of the next one
+	};
+
+	explicit SyntheticAssetGenerator(const Config& config);
+	std::vector<uint8_t> build() const;
+
+private:
+	enum Kind { Bool, Int, Array, Struct, GuidMap };
+
+	Config config_;
+	std::vector<std::string> names_;
+	std::unordered_map<std::string, int64_t> nameIds_;
+	std::vector<Kind> pattern_;
+
+	static void put(std::vector<uint8_t>& out, const void* value, size_t size);
+	template <typename T>
+	static void put(std::vector<uint8_t>& out, T value) { put(out, &value, sizeof(value)); }
+	static void putFString(std::vector<uint8_t>& out, const std::string& text);
+	void putName(std::vector<uint8_t>& out, const char* name) const { put<int64_t>(out, nameIds_.at(name)); }
+	std::vector<uint8_t> body(uint32_t exportIdx) const;
+};
+
+SyntheticAssetGenerator::SyntheticAssetGenerator(const Config& config) : config_(config) {
+	// "None" must not be name 0: a zero FName reads as padding, not as the end of the properties
+	static const char* fixed[] = {
+		"/Game/Synthetic/BP_Synthetic", "None", "BoolProperty", "IntProperty", "MapProperty", "NameProperty", "StructProperty", "ArrayProperty",
+		"ObjectProperty", "Guid", "bCtrl", "NodePosX", "PropertyGuids", "AllNodes", "NodeGuid", "/Script/CoreUObject",
+		"Class", "Package", "/Script/Engine", "Blueprint", "BP_Synthetic", "K2Node_Event",
+	};
+	for (const char* name : fixed) {
+		names_.push_back(name);
+	}
+	for (uint32_t i = 0; i < config_.imports; ++i) {
+		names_.push_back("/Game/Synthetic/Dependency_" + std::to_string(i));
+	}
+	while (names_.size() < config_.names) {
+		names_.push_back("SyntheticName_" + std::to_string(names_.size()));
+	}
+	for (size_t i = 0; i < names_.size(); ++i) {
+		nameIds_[names_[i]] = static_cast<int64_t>(i);
+	}
+
+	// Spread the kinds evenly: kind k appears weight[k] times per cycle
+	const std::pair<Kind, uint32_t> weights[] = {
+		{ Bool, config_.boolWeight }, { Int, config_.intWeight }, { Array, config_.arrayWeight },
+		{ Struct, config_.structWeight }, { GuidMap, config_.guidWeight },
+	};
+	for (uint32_t round = 0;; ++round) {
+		size_t before = pattern_.size();
+		for (const auto& weight : weights) {
+			if (round < weight.second) {
+				pattern_.push_back(weight.first);
+			}
+		}
+		if (pattern_.size() == before) {
+			break;
+		}
+	}
+	if (pattern_.empty()) {
+		pattern_.push_back(Bool);
+	}
+}
+
+void SyntheticAssetGenerator::put(std::vector<uint8_t>& out, const void* value, size_t size) {
+	const uint8_t* bytes = static_cast<const uint8_t*>(value);
+	out.insert(out.end(), bytes, bytes + size);
+}
+
+void SyntheticAssetGenerator::putFString(std::vector<uint8_t>& out, const std::string& text) {
+	put<int32_t>(out, static_cast<int32_t>(text.size() + 1));
+	put(out, text.c_str(), text.size() + 1);
+}
+
+std::vector<uint8_t> SyntheticAssetGenerator::body(uint32_t exportIdx) const {
+	std::vector<uint8_t> out;
+	for (uint32_t p = 0; p < config_.properties; ++p) {
+		uint8_t seed = static_cast<uint8_t>(exportIdx * 31 + p);
+		switch (pattern_[p % pattern_.size()]) {
+		case Bool:
+			putName(out, "bCtrl");
+			putName(out, "BoolProperty");
+			put<int64_t>(out, 0);
+			put<uint8_t>(out, seed & 1);   // BoolVal, in the tag
+			put<uint8_t>(out, 0);          // HasPropertyGuid
+			break;
+		case Int:
+			putName(out, "NodePosX");
+			putName(out, "IntProperty");
+			put<int64_t>(out, 4);
+			put<uint8_t>(out, 0);
+			put<int32_t>(out, seed * 16 - 2048);
+			break;
+		case Array:
+			putName(out, "AllNodes");
+			putName(out, "ArrayProperty");
+			put<int64_t>(out, 4 + 4 * config_.arrayLength);
+			putName(out, "ObjectProperty");
+			put<uint8_t>(out, 0);
+			put<int32_t>(out, static_cast<int32_t>(config_.arrayLength));
+			for (uint32_t k = 0; k < config_.arrayLength; ++k) {
+				put<int32_t>(out, static_cast<int32_t>(k % std::max<uint32_t>(1, config_.exports)) + 1);
+			}
+			break;
+		case Struct:
+			putName(out, "NodeGuid");
+			putName(out, "StructProperty");
+			put<int64_t>(out, 16);
+			putName(out, "Guid");
+			put<int64_t>(out, 0);
+			put<int64_t>(out, 0);
+			put<uint8_t>(out, 0);
+			for (int k = 0; k < 16; ++k) {
+				put<uint8_t>(out, static_cast<uint8_t>(seed + k));
+			}
+			break;
+		case GuidMap:
+			putName(out, "PropertyGuids");
+			putName(out, "MapProperty");
+			put<int64_t>(out, 8 + 24 * config_.guidsPerMap);
+			putName(out, "NameProperty");
+			putName(out, "StructProperty");
+			put<uint8_t>(out, 0);
+			put<int32_t>(out, 0);
+			put<int32_t>(out, static_cast<int32_t>(config_.guidsPerMap));
+			for (uint32_t k = 0; k < config_.guidsPerMap; ++k) {
+				putName(out, "bCtrl");
+				for (int b = 0; b < 16; ++b) {
+					put<uint8_t>(out, static_cast<uint8_t>(seed + k + b));
+				}
+			}
+			break;
+		}
+	}
+	if (config_.paddingTerminator) {
+		put<int64_t>(out, 0);
+	}
+	else {
+		putName(out, "None");
+	}
+	return out;
+}
+
+std::vector<uint8_t> SyntheticAssetGenerator::build() const {
+	const std::string packageName = "/Game/Synthetic/BP_Synthetic";
+	const uint32_t importCount = 3 + config_.imports;
+	const uint32_t exportCount = std::max<uint32_t>(1, config_.exports);
+	struct Offsets {
+		int32_t total = 0, names = 0, imports = 0, exports = 0, depends = 0, thumbnails = 0, registry = 0;
+		int64_t bulk = 0;
+	} offsets;
+
+	std::vector<std::vector<uint8_t>> bodies;
+	for (uint32_t i = 0; i < exportCount; ++i) {
+		bodies.push_back(body(i));
+	}
+
+	// The summary's size does not depend on the offsets it stores, so two passes settle them
+	std::vector<uint8_t> out;
+	for (int pass = 0; pass < 2; ++pass) {
+		out.clear();
+		put<uint32_t>(out, 0x9E2A83C1);
+		put<int32_t>(out, -8);
+		put<int32_t>(out, 864);
+		put<int32_t>(out, 522);
+		put<int32_t>(out, 1009);
+		put<int32_t>(out, 0);
+		put<int32_t>(out, 0);                  // custom versions
+		put<int32_t>(out, offsets.total);
+		putFString(out, packageName);
+		put<uint32_t>(out, 0);                 // package flags
+		put<int32_t>(out, static_cast<int32_t>(names_.size()));
+		put<int32_t>(out, offsets.names);
+		put<uint32_t>(out, 0);                 // soft object paths
+		put<uint32_t>(out, 0);
+		putFString(out, "");                   // localization id
+		put<int32_t>(out, 0);                  // gatherable text
+		put<int32_t>(out, 0);
+		put<int32_t>(out, static_cast<int32_t>(exportCount));
+		put<int32_t>(out, offsets.exports);
+		put<int32_t>(out, static_cast<int32_t>(importCount));
+		put<int32_t>(out, offsets.imports);
+		put<int32_t>(out, offsets.depends);
+		put<uint32_t>(out, 0);                 // soft package references
+		put<uint32_t>(out, 0);
+		put<int32_t>(out, 0);                  // searchable names
+		put<int32_t>(out, offsets.thumbnails);
+		for (int k = 0; k < 32; ++k) {
+			put<uint8_t>(out, 0);              // package and persistent guids
+		}
+		put<int32_t>(out, 1);                  // generations
+		put<int32_t>(out, static_cast<int32_t>(exportCount));
+		put<int32_t>(out, static_cast<int32_t>(names_.size()));
+		for (int k = 0; k < 2; ++k) {          // saved-by and compatible-with engine versions
+			put<uint16_t>(out, 5);
+			put<uint16_t>(out, 1);
+			put<uint16_t>(out, 0);
+			put<uint32_t>(out, 0);
+			putFString(out, "");
+		}
+		put<uint32_t>(out, 0);                 // compression flags
+		put<int32_t>(out, 0);                  // compressed chunks
+		put<uint32_t>(out, 0);                 // package source
+		put<uint32_t>(out, 0);                 // additional packages to cook
+		put<int32_t>(out, offsets.registry);
+		put<int64_t>(out, offsets.bulk);
+		put<int32_t>(out, 0);                  // world tile info
+		put<int32_t>(out, 0);                  // chunk ids
+		put<int32_t>(out, 0);                  // preload dependencies
+		put<int32_t>(out, offsets.total);
+		put<int32_t>(out, 0);                  // names referenced from export data
+		put<int64_t>(out, -1);                 // payload toc
+		put<int32_t>(out, 0);                  // data resources
+
+		offsets.names = static_cast<int32_t>(out.size());
+		for (size_t i = 0; i < names_.size(); ++i) {
+			uint16_t hash, caseHash;
+			computeNameHashes(names_[i], hash, caseHash);
+			putFString(out, names_[i]);
+			put<uint16_t>(out, hash);
+			put<uint16_t>(out, caseHash);
+		}
+
+		offsets.imports = static_cast<int32_t>(out.size());
+		auto putImport = [&](const char* classPackage, const char* className, int32_t outer, const std::string& objectName) {
+			putName(out, classPackage);
+			putName(out, className);
+			put<int32_t>(out, outer);
+			put<int64_t>(out, nameIds_.at(objectName));
+			putName(out, "None");
+			put<int32_t>(out, 0);
+		};
+		putImport("/Script/CoreUObject", "Package", 0, "/Script/Engine");
+		putImport("/Script/CoreUObject", "Class", -1, "Blueprint");
+		putImport("/Script/CoreUObject", "Class", -1, "K2Node_Event");
+		for (uint32_t i = 0; i < config_.imports; ++i) {
+			putImport("/Script/CoreUObject", "Package", 0, "/Game/Synthetic/Dependency_" + std::to_string(i));
+		}
+
+		offsets.exports = static_cast<int32_t>(out.size());
+		int64_t bodyOffset = offsets.total;
+		for (uint32_t i = 0; i < exportCount; ++i) {
+			put<int32_t>(out, i == 0 ? -2 : -3);   // class
+			put<int32_t>(out, 0);                   // super
+			put<int32_t>(out, 0);                   // template
+			put<int32_t>(out, i == 0 ? 0 : config_.outerChain ? static_cast<int32_t>(i) : 1);   // outer
+			put<int32_t>(out, static_cast<int32_t>(nameIds_.at(i == 0 ? "BP_Synthetic" : "K2Node_Event")));
+			put<int32_t>(out, i == 0 ? 0 : static_cast<int32_t>(i));
+			put<uint32_t>(out, 0);                  // object flags
+			put<int64_t>(out, static_cast<int64_t>(bodies[i].size()));
+			put<int64_t>(out, bodyOffset);
+			put<int32_t>(out, 0);                   // forced export, not for client, not for server
+			put<int32_t>(out, 0);
+			put<int32_t>(out, 0);
+			put<int32_t>(out, 0);                   // inherited instance
+			put<uint32_t>(out, 0);                  // package flags
+			put<int32_t>(out, 0);                   // not always loaded for editor game
+			put<int32_t>(out, i == 0 ? 1 : 0);      // is asset
+			put<int32_t>(out, 0);                   // generate public hash
+			put<int32_t>(out, -1);                  // first export dependency and the four counts
+			for (int k = 0; k < 4; ++k) {
+				put<int32_t>(out, 0);
+			}
+			bodyOffset += static_cast<int64_t>(bodies[i].size());
+		}
+
+		offsets.depends = static_cast<int32_t>(out.size());
+		for (uint32_t i = 0; i < exportCount; ++i) {
+			put<int32_t>(out, 0);
+		}
+
+		offsets.registry = static_cast<int32_t>(out.size());
+		put<int64_t>(out, 0);                  // dependency data offset
+		put<int32_t>(out, 0);                  // objects
+
+		offsets.thumbnails = static_cast<int32_t>(out.size());
+		put<int32_t>(out, config_.thumbnailBytes > 0 ? 1 : 0);
+		if (config_.thumbnailBytes > 0) {
+			putFString(out, "Blueprint");
+			putFString(out, "BP_Synthetic");
+			put<int32_t>(out, static_cast<int32_t>(out.size() + 4));
+			put<int32_t>(out, 256);
+			put<int32_t>(out, 256);
+			put<int32_t>(out, static_cast<int32_t>(config_.thumbnailBytes));
+			static const uint8_t png[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+			for (uint32_t k = 0; k < config_.thumbnailBytes; ++k) {
+				put<uint8_t>(out, k < sizeof(png) ? png[k] : static_cast<uint8_t>(k * 7));
+			}
+		}
+
+		offsets.total = static_cast<int32_t>(out.size());
+		for (const std::vector<uint8_t>& body : bodies) {
+			out.insert(out.end(), body.begin(), body.end());
+		}
+		offsets.bulk = static_cast<int64_t>(out.size());
+	}
+	put<uint32_t>(out, 0x9E2A83C1);
+	for (int k = 0; k < 64; ++k) {
+		put<uint8_t>(out, 0);
+	}
+	return out;
+}
+
+// Times the parser's hot paths on one package. It reuses a parsed Uasset so each reader runs
+// against the same state a full parse would leave it in.
+class ParserBenchmark {
+public:
+	struct Result {
+		std::string name;
+		size_t iterations = 0;
+		double totalMs = 0;
+		size_t bytesPerIteration = 0;
+		size_t itemsPerIteration = 0;
+	};
+
+	ParserBenchmark(const std::vector<uint8_t>& bytes, size_t iterations) : bytes_(bytes), iterations_(std::max<size_t>(1, iterations)) {}
+
+	bool run(std::vector<Result>& results);
+
+private:
+	const std::vector<uint8_t>& bytes_;
+	size_t iterations_;
+	size_t sink_ = 0;   // keeps the measured reads observable
+
+	template <typename Fn>
+	Result measure(const char* name, size_t bytes, size_t items, Fn fn) {
+		fn();   // warm up caches and allocator
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations_; ++i) {
+			fn();
+		}
+		return { name, iterations_, elapsedMs(start), bytes, items };
+	}
+};
+
+bool ParserBenchmark::run(std::vector<Result>& results) {
+	Uasset asset;
+	asset.options.verbose = false;
+	if (!asset.parse(bytes_)) {
+		return false;
+	}
+	UassetData& data = asset.data;
+	size_t bodyBytes = 0;
+	for (const UassetData::Export& exportData : data.exports) {
+		bodyBytes += static_cast<size_t>(exportData.serialSize);
+	}
+	size_t namesBytes = data.summaryLayout.namesEnd - static_cast<size_t>(data.header.NameOffset);
+	size_t guidCount = bodyBytes / 16;
+	size_t bodyStart = data.exports.empty() ? static_cast<size_t>(data.header.TotalHeaderSize) : static_cast<size_t>(data.exports.front().serialOffset);
+
+	try {
+		results.push_back(measure("parse", bytes_.size(), data.exports.size(), [&]() {
+			Uasset fresh;
+			fresh.options.verbose = false;
+			sink_ += fresh.parse(bytes_);
+		}));
+		// The same parse with one parser kept across iterations, as the batch modes do
+		Uasset reused;
+		reused.options.verbose = false;
+		results.push_back(measure("parseReused", bytes_.size(), data.exports.size(), [&]() {
+			sink_ += reused.parse(bytes_);
+		}));
+		results.push_back(measure("readNames", namesBytes, data.names.size(), [&]() {
+			asset.readNames();
+			sink_ += data.names.size();
+		}));
+		results.push_back(measure("readExports", bodyBytes, data.exportMap.size(), [&]() {
+			asset.readExports();
+			sink_ += data.exports.size();
+		}));
+		results.push_back(measure("readExportData", bodyBytes, data.exports.size(), [&]() {
+			for (size_t i = 0; i < data.exportMap.size(); ++i) {
+				UassetData::Export exportData;
+				asset.fillExportRecord(exportData, i);
+				asset.readExportData(exportData);
+				sink_ += exportData.properties.size();
+			}
+		}));
+		results.push_back(measure("readGuid", guidCount * 16, guidCount, [&]() {
+			asset.currentIdx = bodyStart;
+			for (size_t i = 0; i < guidCount; ++i) {
+				sink_ += asset.readGuid().size();
+			}
+		}));
+		results.push_back(measure("findNameIndex", namesBytes, data.names.size(), [&]() {
+			for (const UassetData::Name& name : data.names) {
+				sink_ += static_cast<size_t>(findNameIndex(data, name.Name) + 1);
+			}
+		}));
+		results.push_back(measure("verifyNameHashes", namesBytes, data.names.size(), [&]() {
+			sink_ += UassetData::NameIndex::verifyHashes(data.names).checked;
+		}));
+		results.push_back(measure("readFString", namesBytes, data.names.size(), [&]() {
+			asset.currentIdx = static_cast<size_t>(data.header.NameOffset);
+			for (size_t i = 0; i < data.names.size(); ++i) {
+				sink_ += asset.readFString().size();
+				asset.currentIdx += 2 * sizeof(uint16_t);
+			}
+		}));
+		results.push_back(measure("toJson", bytes_.size(), data.exports.size(), [&]() {
+			sink_ += asset.toJson().size();
+		}));
+	}
+	catch (const ParseException& e) {
+		std::cerr << e.what() << std::endl;
+		return false;
+	}
+	return sink_ != 0;
+}
+
+static void printPackages(const DependencyGraph& graph, const std::vector<uint32_t>& nodes) {
+	for (uint32_t node : nodes) {
+		std::cout << "  " << graph.packages[node] << std::endl;
+	}
+}
+
+// UEParser --deps <ContentDir> [--rdeps <Package>] [--closure <Package>] [--rclosure <Package>] [--cycles]
+int runDependencyMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --deps <ContentDir> [--rdeps <Package>] [--closure <Package>] [--rclosure <Package>] [--cycles]" << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::string> files = collectAssetFiles(argv[2]);
+	DependencyGraph graph = buildDependencyGraph(files);
+	std::cout << "Indexed " << files.size() << " files: " << graph.nodeCount() << " packages, "
+		<< graph.edgeCount() << " edges in " << elapsedMs(start) << " ms" << std::endl;
+
+	for (int i = 3; i < argc; ++i) {
+		std::string option = argv[i];
+		if (option == "--cycles") {
+			start = std::chrono::steady_clock::now();
+			std::vector<std::vector<uint32_t>> cycles = graph.cycles();
+			std::cout << "Cycles: " << cycles.size() << " (" << elapsedMs(start) << " ms)" << std::endl;
+			for (const std::vector<uint32_t>& cycle : cycles) {
+				std::cout << " Cycle of " << cycle.size() << " packages:" << std::endl;
+				printPackages(graph, cycle);
+			}
+			continue;
+		}
+		if (i + 1 >= argc) {
+			std::cerr << "Missing package name after " << option << std::endl;
+			return 1;
+		}
+		uint32_t node = graph.find(argv[++i]);
+		if (node == DependencyGraph::InvalidNode) {
+			std::cerr << "Unknown package " << argv[i] << std::endl;
+			continue;
+		}
+
+		start = std::chrono::steady_clock::now();
+		std::vector<uint32_t> result;
+		if (option == "--rdeps") {
+			result = graph.dependents(node);
+		}
+		else if (option == "--closure") {
+			result = graph.transitiveDependencies(node);
+		}
+		else if (option == "--rclosure") {
+			result = graph.transitiveDependents(node);
+		}
+		else {
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+		std::cout << option << " " << argv[i] << ": " << result.size() << " packages (" << elapsedMs(start) << " ms)" << std::endl;
+		printPackages(graph, result);
+	}
+	return 0;
+}
+
+static std::string exportName(const UassetData& data, int32_t exportIndex) {
+	const std::string& path = data.objectGraph.fullPath(exportIndex);
+	return path.empty() ? "#" + std::to_string(exportIndex) : path;
+}
+
+static void printLoadOrderReport(const UassetData& data, const LoadOrderReport& report) {
+	std::cout << "Steps: " << report.stepCount << ", edges: " << report.edgeCount
+		<< ", import dependencies: " << report.importDependencies
+		<< ", invalid dependencies: " << report.invalidDependencies << std::endl;
+	if (report.hasCycle) {
+		std::cout << "Dependency cycle: some exports can never be loaded" << std::endl;
+	}
+	std::cout << "Critical path: " << report.criticalPathDepth << " steps, "
+		<< report.criticalPathBytes << " bytes serialized; widest level: " << report.maxParallelSteps << " steps" << std::endl;
+	for (uint32_t step : report.criticalPath) {
+		std::cout << "  " << (LoadOrderReport::isSerializeStep(step) ? "serialize " : "create    ")
+			<< exportName(data, LoadOrderReport::exportOfStep(step)) << std::endl;
+	}
+	std::cout << "Bottlenecks:" << std::endl;
+	for (const LoadOrderReport::Bottleneck& bottleneck : report.bottlenecks) {
+		std::cout << "  " << exportName(data, bottleneck.exportIndex) << ": blocks " << bottleneck.blockedSteps
+			<< " steps at depth " << bottleneck.depth << ", " << bottleneck.serialSize << " bytes" << std::endl;
+	}
+}
+
+// UEParser --load-order <File|ContentDir>
+// A file gets a full report; a directory lists its packages by critical-path depth.
+int runLoadOrderMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --load-order <File|ContentDir>" << std::endl;
+		return 1;
+	}
+
+	std::vector<std::string> files;
+	bool singleFile = !std::filesystem::is_directory(argv[2]);
+	if (singleFile) {
+		files.push_back(argv[2]);
+	}
+	else {
+		files = collectAssetFiles(argv[2]);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<LoadOrderReport> reports(files.size());
+	std::vector<uint8_t> loaded(files.size(), 0);
+	std::vector<UassetData> singleData(singleFile ? 1 : 0);
+	parallelFor(files.size(), [&](size_t i) {
+		Uasset uasset;
+		uasset.options.readThumbnails = false;
+		std::vector<uint8_t> bytes;
+		try {
+			if (loadPackageHeader(files[i], uasset, bytes)) {
+				reports[i] = simulateLoadOrder(uasset.data);
+				loaded[i] = 1;
+				if (singleFile) {
+					singleData[0] = std::move(uasset.data);
+				}
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+		}
+	});
+
+	if (singleFile) {
+		if (!loaded[0]) {
+			std::cerr << "Failed to parse uasset file" << std::endl;
+			return 1;
+		}
+		printLoadOrderReport(singleData[0], reports[0]);
+		return 0;
+	}
+
+	std::vector<size_t> ranking;
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (loaded[i]) {
+			ranking.push_back(i);
+		}
+	}
+	std::sort(ranking.begin(), ranking.end(), [&](size_t a, size_t b) {
+		return reports[a].criticalPathDepth > reports[b].criticalPathDepth;
+	});
+	std::cout << "Simulated " << ranking.size() << " of " << files.size() << " files in " << elapsedMs(start) << " ms" << std::endl;
+	for (size_t i : ranking) {
+		const LoadOrderReport& report = reports[i];
+		std::cout << report.criticalPathDepth << " steps / " << report.stepCount << "  "
+			<< report.criticalPathBytes << " bytes  " << files[i]
+			<< (report.hasCycle ? "  (cycle)" : "") << std::endl;
+	}
+	return 0;
+}
+
+// UEParser --tags <ContentDir> [--find <Key>=<Value>] [--values <Key>]
+int runTagIndexMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --tags <ContentDir> [--find <Key>=<Value>] [--values <Key>]" << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::string> files = collectAssetFiles(argv[2]);
+	std::vector<AssetRegistryData> registries(files.size());
+	std::vector<std::string> packageNames(files.size());
+	parallelFor(files.size(), [&](size_t i) {
+		Uasset uasset;
+		uasset.options.readThumbnails = false;
+		uasset.options.readAssetRegistry = true;
+		std::vector<uint8_t> bytes;
+		try {
+			if (loadPackageHeader(files[i], uasset, bytes)) {
+				packageNames[i] = packageNameForFile(files[i], uasset.data);
+				registries[i] = std::move(uasset.data.assetRegistryData);
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+		}
+	});
+
+	AssetTagIndex index;
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (!packageNames[i].empty()) {
+			index.add(packageNames[i], registries[i]);
+		}
+	}
+	std::cout << "Indexed " << index.assets.size() << " of " << files.size() << " files: " << index.keys.size()
+		<< " keys, " << index.values.size() << " values in " << elapsedMs(start) << " ms" << std::endl;
+
+	for (int i = 3; i + 1 < argc; i += 2) {
+		std::string option = argv[i];
+		std::string argument = argv[i + 1];
+		start = std::chrono::steady_clock::now();
+		if (option == "--find") {
+			size_t eq = argument.find('=');
+			if (eq == std::string::npos) {
+				std::cerr << "Expected <Key>=<Value> after --find" << std::endl;
+				return 1;
+			}
+			const std::vector<uint32_t>& assets = index.find(argument.substr(0, eq), argument.substr(eq + 1));
+			std::cout << argument << ": " << assets.size() << " assets (" << elapsedMs(start) << " ms)" << std::endl;
+			for (uint32_t asset : assets) {
+				std::cout << "  " << index.assets[asset] << std::endl;
+			}
+		}
+		else if (option == "--values") {
+			std::vector<std::pair<std::string, size_t>> values = index.valuesOf(argument);
+			std::cout << argument << ": " << values.size() << " values (" << elapsedMs(start) << " ms)" << std::endl;
+			for (const auto& value : values) {
+				std::cout << "  " << value.first << " (" << value.second << ")" << std::endl;
+			}
+		}
+		else {
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// UEParser --find-exports <ContentDir> [--class <Name>] [--outer <Index>] [--flags <Mask>] [--min-size <Bytes>]
+// Lists exports across a project. Headers are loaded in parallel, the per-package column
+// filters narrow each export map, and the class filter runs over the project-wide table.
+int runExportQueryMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --find-exports <ContentDir> [--class <Name>] [--outer <Index>] [--flags <Mask>] [--min-size <Bytes>]" << std::endl;
+		return 1;
+	}
+
+	std::string className;
+	bool hasOuter = false;
+	bool hasFlags = false;
+	bool hasMinSize = false;
+	int32_t outerIndex = 0;
+	uint32_t flagMask = 0;
+	int64_t minSize = 0;
+	for (int i = 3; i + 1 < argc; i += 2) {
+		std::string option = argv[i];
+		std::string argument = argv[i + 1];
+		try {
+			if (option == "--class") {
+				className = argument;
+			}
+			else if (option == "--outer") {
+				outerIndex = static_cast<int32_t>(std::stol(argument));
+				hasOuter = true;
+			}
+			else if (option == "--flags") {
+				flagMask = static_cast<uint32_t>(std::stoul(argument, nullptr, 0));
+				hasFlags = true;
+			}
+			else if (option == "--min-size") {
+				minSize = std::stoll(argument);
+				hasMinSize = true;
+			}
+			else {
+				std::cerr << "Unknown option " << option << std::endl;
+				return 1;
+			}
+		}
+		catch (const std::exception&) {
+			std::cerr << "Invalid value for " << option << ": " << argument << std::endl;
+			return 1;
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::string> files = collectAssetFiles(argv[2]);
+	std::vector<UassetData> headers(files.size());
+	std::vector<std::string> packageNames(files.size());
+	std::vector<std::vector<uint8_t>> selected(files.size());
+	parallelFor(files.size(), [&](size_t i) {
+		Uasset uasset;
+		uasset.options.readThumbnails = false;
+		std::vector<uint8_t> bytes;
+		try {
+			if (!loadPackageHeader(files[i], uasset, bytes)) {
+				return;
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+			return;
+		}
+		packageNames[i] = packageNameForFile(files[i], uasset.data);
+		headers[i] = std::move(uasset.data);
+
+		// selected[i][n] is set when export n (1-based) passes every column filter
+		const UassetData::ExportMap& map = headers[i].exportMap;
+		std::vector<uint8_t>& keep = selected[i];
+		keep.assign(map.size() + 1, 1);
+		keep[0] = 0;
+		auto intersect = [&](const std::vector<int32_t>& matches) {
+			std::vector<uint8_t> hit(keep.size());
+			for (int32_t n : matches) {
+				hit[n] = 1;
+			}
+			for (size_t n = 0; n < keep.size(); ++n) {
+				keep[n] &= hit[n];
+			}
+		};
+		if (hasOuter) {
+			intersect(filterExportsByOuter(map, outerIndex));
+		}
+		if (hasFlags) {
+			intersect(filterExportsByFlags(map, flagMask));
+		}
+		if (hasMinSize) {
+			intersect(filterExportsBySerialSize(map, minSize));
+		}
+	});
+
+	ProjectExportTable table;
+	size_t loaded = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (!packageNames[i].empty()) {
+			table.append(static_cast<uint32_t>(i), headers[i]);
+			++loaded;
+		}
+	}
+
+	std::vector<size_t> rows;
+	if (className.empty()) {
+		rows.resize(table.size());
+		for (size_t row = 0; row < rows.size(); ++row) {
+			rows[row] = row;
+		}
+	}
+	else {
+		rows = table.rowsWithClass(className);
+	}
+
+	size_t matched = 0;
+	for (size_t row : rows) {
+		uint32_t package = table.packageId[row];
+		int32_t exportIndex = table.exportIndex[row];
+		if (!selected[package][exportIndex]) {
+			continue;
+		}
+		++matched;
+		// The graph's path follows the outer chain; it only lacks the package when the summary
+		// has no FolderName, and is empty past MaxPathLength
+		const UassetData::ObjectGraph& graph = headers[package].objectGraph;
+		const std::string& path = graph.fullPath(exportIndex);
+		if (path.empty()) {
+			const UassetData::ObjectGraph::Object* object = graph.find(exportIndex);
+			std::cout << packageNames[package] << "." << (object ? object->objectName : std::string());
+		}
+		else if (graph.packagePath.empty()) {
+			std::cout << packageNames[package] << "." << path;
+		}
+		else {
+			std::cout << path;
+		}
+		std::cout << " [" << exportIndex << "] "
+			<< table.classNames[table.classNameId[row]] << " outer=" << table.outerIndex[row]
+			<< " flags=0x" << std::hex << table.objectFlags[row] << std::dec
+			<< " size=" << table.serialSize[row] << std::endl;
+	}
+	std::cout << "Matched " << matched << " of " << table.size() << " exports in " << loaded << " of "
+		<< files.size() << " files in " << elapsedMs(start) << " ms" << std::endl;
+	return 0;
+}
+
+// UEParser --thumbnails <ContentDir> <OutputDir>
+// Writes every thumbnail as <OutputDir>/<PackagePath>/<Object>.png|.jpg. Each worker holds one
+// package header and a 64 KB copy buffer, so memory stays bounded regardless of corpus size.
+int runThumbnailDumpMode(int argc, char* argv[]) {
+	if (argc < 4) {
+		std::cerr << "Usage: UEParser --thumbnails <ContentDir> <OutputDir>" << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::string> files = collectAssetFiles(argv[2]);
+	const std::filesystem::path outputRoot(argv[3]);
+	std::atomic<size_t> written(0);
+	std::atomic<int64_t> writtenBytes(0);
+	std::atomic<size_t> failed(0);
+
+	parallelFor(files.size(), [&](size_t i) {
+		Uasset uasset;
+		uasset.options.readThumbnails = true;
+		std::vector<uint8_t> bytes;
+		try {
+			if (!loadPackageHeader(files[i], uasset, bytes)) {
+				++failed;
+				return;
+			}
+			bytes.clear();
+			bytes.shrink_to_fit();
+
+			const UassetData& data = uasset.data;
+			if (data.thumbnails.empty()) {
+				return;
+			}
+			std::ifstream in(files[i], std::ios::binary);
+			std::string packagePath = packageNameForFile(files[i], data);
+			size_t first = packagePath.find_first_not_of('/');
+			packagePath = first == std::string::npos ? std::string() : packagePath.substr(first);
+			// Package and object names come from the file, so they must not reach outside outputRoot
+			std::filesystem::path directory = outputRoot / packagePath;
+			if ((!packagePath.empty() && !isSafeRelativePath(packagePath, true)) || !isWithinDirectory(outputRoot, directory)) {
+				std::cerr << files[i] << ": unsafe package name " << packagePath << std::endl;
+				++failed;
+				return;
+			}
+			std::error_code ec;
+			std::filesystem::create_directories(directory, ec);
+
+			for (size_t t = 0; t < data.thumbnails.size() && t < data.thumbnailsIndex.size(); ++t) {
+				const Thumbnail& thumbnail = data.thumbnails[t];
+				if (thumbnail.ImageSizeData <= 0) {
+					continue;
+				}
+				std::string name = data.thumbnailsIndex[t].ObjectPathWithoutPackageName;
+				std::replace(name.begin(), name.end(), ':', '_');
+				std::filesystem::path target = directory / (name + (thumbnail.ImageFormat == "JPEG" ? ".jpg" : ".png"));
+				if (!isSafeRelativePath(name, false) || !isWithinDirectory(outputRoot, target)) {
+					std::cerr << files[i] << ": unsafe thumbnail name " << name << std::endl;
+					++failed;
+					continue;
+				}
+				std::ofstream out(target, std::ios::binary);
+				if (out && copyThumbnailImage(in, thumbnail, out)) {
+					++written;
+					writtenBytes += thumbnail.ImageSizeData;
+				}
+				else {
+					std::cerr << files[i] << ": failed to write " << target.generic_string() << std::endl;
+					++failed;
+				}
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+			++failed;
+		}
+	});
+
+	std::cout << "Wrote " << written << " thumbnails (" << writtenBytes << " bytes) from " << files.size()
+		<< " files in " << elapsedMs(start) << " ms, " << failed << " failures" << std::endl;
+	return failed == 0 ? 0 : 1;
+}
+
+// UEParser --patch <File> <OutFile> <ExportIndex> <PropertyName> <Value> [<Occurrence>]
+// Writes Value over the Occurrence-th (default first) property with that name in the export
+// (1-based, as in the export table). OutFile may equal File to patch in place.
+int runPatchMode(int argc, char* argv[]) {
+	if (argc < 7) {
+		std::cerr << "Usage: UEParser --patch <File> <OutFile> <ExportIndex> <PropertyName> <Value> [<Occurrence>]" << std::endl;
+		return 1;
+	}
+	std::string source = argv[2];
+	std::string target = argv[3];
+	std::string propertyName = argv[5];
+	std::string value = argv[6];
+	int exportIndex = std::atoi(argv[4]);
+	int occurrence = argc > 7 ? std::atoi(argv[7]) : 1;
+
+	std::vector<uint8_t> bytes;
+	Uasset uasset;
+	uasset.options.verbose = false;
+	uasset.options.readThumbnails = false;
+	if (!readFileBytes(source, bytes) || !uasset.parse(bytes)) {
+		std::cerr << "Failed to parse uasset file" << std::endl;
+		return 1;
+	}
+	if (exportIndex < 1 || static_cast<size_t>(exportIndex) > uasset.data.exports.size()) {
+		std::cerr << "Export index out of range" << std::endl;
+		return 1;
+	}
+
+	const UassetData::Export::Property* property = nullptr;
+	for (const UassetData::Export::Property& candidate : uasset.data.exports[exportIndex - 1].properties) {
+		if (candidate.PropertyName == propertyName && --occurrence == 0) {
+			property = &candidate;
+			break;
+		}
+	}
+	if (property == nullptr) {
+		std::cerr << "Property " << propertyName << " not found" << std::endl;
+		return 1;
+	}
+	uasset.release();
+	bytes.clear();
+	bytes.shrink_to_fit();
+
+	PackagePatcher patcher;
+	if (!patcher.open(source, target) || !patcher.set(*property, value)) {
+		return 1;
+	}
+	patcher.close();
+	std::cout << "Patched " << propertyName << " (" << patcher.bytesWritten() << " bytes at offset "
+		<< property->valueOffset << ")" << std::endl;
+	return 0;
+}
+
+// UEParser --resave <File> <OutFile> [--rename <Old>=<New>] [--add-name <Name>]
+// Parses the package, applies the name edits and writes it back through UassetWriter.
+int runResaveMode(int argc, char* argv[]) {
+	if (argc < 4) {
+		std::cerr << "Usage: UEParser --resave <File> <OutFile> [--rename <Old>=<New>] [--add-name <Name>]" << std::endl;
+		return 1;
+	}
+
+	std::vector<uint8_t> bytes;
+	Uasset uasset;
+	uasset.options.verbose = false;
+	uasset.options.readExportData = false;
+	uasset.options.readThumbnails = false;
+	if (!readFileBytes(argv[2], bytes) || !uasset.parse(bytes)) {
+		std::cerr << "Failed to parse uasset file" << std::endl;
+		return 1;
+	}
+
+	for (int i = 4; i + 1 < argc; i += 2) {
+		std::string option = argv[i];
+		std::string argument = argv[i + 1];
+		if (option == "--rename") {
+			size_t eq = argument.find('=');
+			auto it = std::find_if(uasset.data.names.begin(), uasset.data.names.end(), [&](const UassetData::Name& name) {
+				return eq != std::string::npos && name.Name == argument.substr(0, eq);
+			});
+			if (it == uasset.data.names.end()) {
+				std::cerr << "Name " << argument << " not found" << std::endl;
+				return 1;
+			}
+			it->Name = argument.substr(eq + 1);
+			computeNameHashes(it->Name, it->NonCasePreservingHash, it->CasePreservingHash);
+		}
+		else if (option == "--add-name") {
+			UassetData::Name name;
+			name.Name = argument;
+			computeNameHashes(name.Name, name.NonCasePreservingHash, name.CasePreservingHash);
+			uasset.data.names.push_back(name);
+		}
+		else {
+			std::cerr << "Unknown option " << option << std::endl;
+			return 1;
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<uint8_t> output;
+	try {
+		output = UassetWriter(uasset.data, bytes).write();
+	}
+	catch (const ParseException& e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+	double writeMs = elapsedMs(start);
+
+	std::ofstream out(argv[3], std::ios::binary);
+	out.write(reinterpret_cast<const char*>(output.data()), output.size());
+	if (!out) {
+		std::cerr << "Failed to write " << argv[3] << std::endl;
+		return 1;
+	}
+	std::cout << "Wrote " << output.size() << " bytes in " << writeMs << " ms"
+		<< (output == bytes ? " (identical to source)" : "") << std::endl;
+	return 0;
+}
+
+static void printList(const char* label, const std::vector<std::string>& items) {
+	for (const std::string& item : items) {
+		std::cout << label << item << std::endl;
+	}
+}
+
+// UEParser --diff <OldFile> <NewFile>
+int runDiffMode(int argc, char* argv[]) {
+	if (argc < 4) {
+		std::cerr << "Usage: UEParser --diff <OldFile> <NewFile>" << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<uint8_t> bytes[2];
+	Uasset uassets[2];
+	for (int i = 0; i < 2; ++i) {
+		uassets[i].options.verbose = false;
+		uassets[i].options.readThumbnails = false;
+		if (!readFileBytes(argv[2 + i], bytes[i]) || !uassets[i].parse(bytes[i])) {
+			std::cerr << "Failed to parse " << argv[2 + i] << std::endl;
+			return 1;
+		}
+	}
+	double parseMs = elapsedMs(start);
+
+	start = std::chrono::steady_clock::now();
+	std::vector<uint64_t> hashesA = hashExportBodies(uassets[0].data, bytes[0]);
+	std::vector<uint64_t> hashesB = hashExportBodies(uassets[1].data, bytes[1]);
+	double hashMs = elapsedMs(start);
+
+	start = std::chrono::steady_clock::now();
+	UassetDiff diff = diffUassets(uassets[0].data, hashesA, uassets[1].data, hashesB);
+	double diffMs = elapsedMs(start);
+
+	printList("+ name ", diff.namesAdded);
+	printList("- name ", diff.namesRemoved);
+	printList("+ import ", diff.importsAdded);
+	printList("- import ", diff.importsRemoved);
+	printList("+ export ", diff.exportsAdded);
+	printList("- export ", diff.exportsRemoved);
+	for (const UassetDiff::ExportChange& change : diff.exportsChanged) {
+		std::cout << "~ export " << change.path << (change.bodyChanged ? " (body changed)" : "") << std::endl;
+		printList("    ", change.fieldChanges);
+		for (const UassetDiff::PropertyChange& property : change.propertyChanges) {
+			std::cout << "    " << property.name << ": "
+				<< (property.before.empty() ? "<none>" : property.before) << " -> "
+				<< (property.after.empty() ? "<none>" : property.after) << std::endl;
+		}
+	}
+	std::cout << (diff.empty() ? "No differences" : "Differences found") << "; " << diff.exportsIdentical
+		<< " exports identical. Parse " << parseMs << " ms, hash " << hashMs << " ms, diff " << diffMs << " ms" << std::endl;
+	return diff.empty() ? 0 : 2;
+}
+
+
+static void printGraphNodes(const UassetData& data, const BlueprintGraph& graph, const std::vector<uint32_t>& list) {
+	for (uint32_t n : list) {
+		const BlueprintGraph::Node& node = graph.nodes[n];
+		std::cout << "  " << exportName(data, node.exportIndex) << " [" << graph.className(n) << "] at ("
+			<< node.posX << ", " << node.posY << ")" << std::endl;
+	}
+}
+
+// UEParser --graph <File> [--from <ExportIndex|Path>]
+// Without --from, reachability starts at every event and function entry node.
+int runBlueprintGraphMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --graph <File> [--from <ExportIndex|Path>]" << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<uint8_t> bytes;
+	Uasset uasset;
+	uasset.options.verbose = false;
+	uasset.options.readThumbnails = false;
+	if (!readFileBytes(argv[2], bytes) || !uasset.parse(bytes)) {
+		std::cerr << "Failed to parse uasset file" << std::endl;
+		return 1;
+	}
+	double parseMs = elapsedMs(start);
+
+	start = std::chrono::steady_clock::now();
+	BlueprintGraph graph;
+	graph.build(uasset.data);
+	double buildMs = elapsedMs(start);
+	std::cout << "Nodes: " << graph.nodes.size() << ", pins: " << graph.pins.size() << ", links: " << graph.linkTargets.size()
+		<< ", edges: " << graph.edgeCount() << ", unresolved links: " << graph.unresolvedLinks
+		<< " (parse " << parseMs << " ms, build " << buildMs << " ms)" << std::endl;
+
+	std::vector<uint32_t> roots;
+	if (argc >= 5 && std::string(argv[3]) == "--from") {
+		std::string from = argv[4];
+		const UassetData::ObjectGraph::Object* object = uasset.data.objectGraph.findByPath(from);
+		int32_t exportIndex = object ? object->packageIndex : std::atoi(from.c_str());
+		uint32_t node = graph.findByExport(exportIndex);
+		if (node == BlueprintGraph::InvalidNode) {
+			std::cerr << "Not a graph node: " << from << std::endl;
+			return 1;
+		}
+		roots.push_back(node);
+	}
+	else {
+		roots = graph.entries();
+		std::cout << "Entries: " << roots.size() << std::endl;
+		printGraphNodes(uasset.data, graph, roots);
+	}
+
+	std::vector<uint32_t> reachable = graph.reachableFrom(roots);
+	std::cout << "Reachable: " << reachable.size() << std::endl;
+	printGraphNodes(uasset.data, graph, reachable);
+	std::vector<uint32_t> dead = graph.deadNodes();
+	std::cout << "Dead nodes: " << dead.size() << std::endl;
+	printGraphNodes(uasset.data, graph, dead);
+	return 0;
+}
+
+// Callee of a call instruction: the function object for final calls, the name for virtual ones
+static std::string kismetCallee(const UassetData& data, const KismetInstruction& instruction) {
+	return instruction.objectRef != 0 ? exportName(data, instruction.objectRef) : instruction.name;
+}
+
+static void printKismetFunction(const UassetData& data, const KismetFunction& function) {
+	std::cout << "Function " << exportName(data, function.exportIndex) << ": " << function.scriptSize << " bytes, "
+		<< function.instructions.size() << " instructions" << std::endl;
+	if (!function.error.empty()) {
+		std::cout << "  error: " << function.error << std::endl;
+	}
+	for (const KismetInstruction& instruction : function.instructions) {
+		std::cout << "  " << std::setw(6) << instruction.offset << " " << std::string(instruction.depth * 2, ' ')
+			<< KismetDisassembler::mnemonic(instruction.opcode);
+		if (!instruction.name.empty()) {
+			std::cout << " " << instruction.name;
+		}
+		if (instruction.objectRef != 0) {
+			std::cout << " " << exportName(data, instruction.objectRef);
+		}
+		if (!instruction.literal.empty()) {
+			std::cout << " " << instruction.literal;
+		}
+		std::cout << std::endl;
+	}
+}
+
+// UEParser --disasm <File|ContentDir>
+// A file gets a full listing; a directory gets a call count per callee across all functions.
+int runDisassemblerMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --disasm <File|ContentDir>" << std::endl;
+		return 1;
+	}
+
+	bool singleFile = !std::filesystem::is_directory(argv[2]);
+	std::vector<std::string> files;
+	if (singleFile) {
+		files.push_back(argv[2]);
+	}
+	else {
+		files = collectAssetFiles(argv[2]);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::unordered_map<std::string, size_t>> calls(files.size());
+	std::vector<size_t> functionCounts(files.size(), 0);
+	std::vector<size_t> instructionCounts(files.size(), 0);
+	std::vector<size_t> failures(files.size(), 0);
+	parallelForEach<PackageReader>(files.size(), [&](PackageReader& reader, size_t i) {
+		Uasset& uasset = reader.uasset;
+		uasset.options.verbose = false;
+		uasset.options.readExportData = false;
+		uasset.options.readThumbnails = false;
+		std::vector<uint8_t>& bytes = reader.bytes;
+		try {
+			if (!readFileBytes(files[i], bytes) || !uasset.parse(bytes)) {
+				std::cerr << files[i] << ": failed to parse" << std::endl;
+				return;
+			}
+			std::vector<KismetFunction> functions = disassembleFunctions(uasset.data, bytes, singleFile);
+			functionCounts[i] = functions.size();
+			for (const KismetFunction& function : functions) {
+				if (singleFile) {
+					printKismetFunction(uasset.data, function);
+				}
+				if (!function.error.empty()) {
+					++failures[i];
+				}
+				instructionCounts[i] += function.instructions.size();
+				for (const KismetInstruction& instruction : function.instructions) {
+					if (KismetDisassembler::isCall(instruction.opcode)) {
+						++calls[i][kismetCallee(uasset.data, instruction)];
+					}
+				}
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+		}
+	});
+
+	std::unordered_map<std::string, size_t> totals;
+	size_t functionTotal = 0;
+	size_t instructionTotal = 0;
+	size_t failureTotal = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		for (const auto& call : calls[i]) {
+			totals[call.first] += call.second;
+		}
+		functionTotal += functionCounts[i];
+		instructionTotal += instructionCounts[i];
+		failureTotal += failures[i];
+	}
+	std::vector<std::pair<std::string, size_t>> ranking(totals.begin(), totals.end());
+	std::sort(ranking.begin(), ranking.end(), [](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b) {
+		return a.second != b.second ? a.second > b.second : a.first < b.first;
+	});
+
+	std::cout << "Disassembled " << functionTotal << " functions (" << instructionTotal << " instructions, "
+		<< failureTotal << " failed) in " << files.size() << " files in " << elapsedMs(start) << " ms" << std::endl;
+	std::cout << "Calls:" << std::endl;
+	for (const auto& entry : ranking) {
+		std::cout << "  " << std::setw(8) << entry.second << "  " << entry.first << std::endl;
+	}
+	return 0;
+}
+
+// UEParser --find-name <ContentDir> <Pattern>... [--index <File>]
+// Lists the packages whose name table has a name containing any pattern (case-insensitive);
+// a pattern starting with '=' must match a whole name. The Bloom filter index defaults to
+// <ContentDir>/.ueparser-names and is refreshed for packages that changed.
+int runNameSearchMode(int argc, char* argv[]) {
+	if (argc < 4) {
+		std::cerr << "Usage: UEParser --find-name <ContentDir> <Pattern>... [--index <File>]" << std::endl;
+		return 1;
+	}
+
+	std::string root = argv[2];
+	std::string indexPath = (std::filesystem::path(root) / ".ueparser-names").string();
+	struct Pattern {
+		std::string text;
+		bool exact;
+	};
+	std::vector<Pattern> patterns;
+	for (int i = 3; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--index" && i + 1 < argc) {
+			indexPath = argv[++i];
+		}
+		else if (arg.size() > 1 && arg[0] == '=') {
+			patterns.push_back({ NameScanner::lower(arg.substr(1)), true });
+		}
+		else if (!arg.empty()) {
+			patterns.push_back({ NameScanner::lower(arg), false });
+		}
+	}
+	if (patterns.empty()) {
+		std::cerr << "No patterns given" << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::string> files = collectAssetFiles(root);
+	NameSearchIndex index;
+	bool indexLoaded = index.load(indexPath);
+
+	std::vector<NameSearchIndex::Entry> entries(files.size());
+	std::vector<uint8_t> refreshed(files.size(), 0);
+	std::vector<uint8_t> skipped(files.size(), 0);
+	std::vector<std::vector<std::string>> matches(files.size());
+	parallelFor(files.size(), [&](size_t i) {
+		NameSearchIndex::Entry& entry = entries[i];
+		fileStamp(files[i], entry.fileSize, entry.modifiedTime);
+
+		auto cached = index.entries.find(files[i]);
+		if (cached != index.entries.end() && cached->second.fileSize == entry.fileSize && cached->second.modifiedTime == entry.modifiedTime) {
+			entry.filter = cached->second.filter;
+			bool possible = false;
+			for (const Pattern& pattern : patterns) {
+				possible = possible || (pattern.exact ? entry.filter.mayContainName(pattern.text) : entry.filter.mayContainSubstring(pattern.text));
+			}
+			if (!possible) {
+				skipped[i] = 1;
+				return;
+			}
+		}
+		else {
+			refreshed[i] = 1;
+		}
+
+		Uasset uasset;
+		std::vector<uint8_t> bytes;
+		if (!loadPackageNames(files[i], uasset, bytes)) {
+			std::cerr << files[i] << ": failed to read name table" << std::endl;
+			entry.filter.bits.clear();
+			return;
+		}
+		if (refreshed[i]) {
+			entry.filter.build(uasset.data.names);
+		}
+		NameScanner scanner(uasset.data.names);
+		std::vector<uint32_t> found;
+		for (const Pattern& pattern : patterns) {
+			if (pattern.exact) {
+				int32_t name = findNameIndexIgnoreCase(uasset.data, pattern.text);
+				if (name >= 0) {
+					found.push_back(static_cast<uint32_t>(name));
+				}
+			}
+			else {
+				std::vector<uint32_t> names = scanner.find(pattern.text);
+				found.insert(found.end(), names.begin(), names.end());
+			}
+		}
+		std::sort(found.begin(), found.end());
+		found.erase(std::unique(found.begin(), found.end()), found.end());
+		for (uint32_t name : found) {
+			matches[i].push_back(uasset.data.names[name].Name);
+		}
+	});
+
+	size_t matchedFiles = 0;
+	size_t skippedFiles = 0;
+	size_t refreshedFiles = 0;
+	index.entries.clear();
+	for (size_t i = 0; i < files.size(); ++i) {
+		skippedFiles += skipped[i];
+		refreshedFiles += refreshed[i];
+		if (!entries[i].filter.bits.empty()) {
+			index.entries.emplace(files[i], std::move(entries[i]));
+		}
+		if (matches[i].empty()) {
+			continue;
+		}
+		++matchedFiles;
+		std::cout << files[i] << std::endl;
+		for (const std::string& name : matches[i]) {
+			std::cout << "  " << name << std::endl;
+		}
+	}
+	if ((refreshedFiles > 0 || index.entries.size() != files.size() || !indexLoaded) && !index.save(indexPath)) {
+		std::cerr << "Failed to write index " << indexPath << std::endl;
+	}
+	std::cout << matchedFiles << " of " << files.size() << " files match; " << skippedFiles << " skipped by the index, "
+		<< refreshedFiles << " indexed (" << elapsedMs(start) << " ms)" << std::endl;
+	return 0;
+}
+
+// UEParser --serve <SocketPath> [--cache <Packages>] [--threads <Count>]
+int runServerMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --serve <SocketPath> [--cache <Packages>] [--threads <Count>]" << std::endl;
+		return 1;
+	}
+#ifdef _WIN32
+	std::cerr << "--serve needs Unix domain sockets and is not available on this platform" << std::endl;
+	return 1;
+#else
+	size_t cacheCapacity = 256;
+	size_t threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+	for (int i = 3; i + 1 < argc; i += 2) {
+		std::string option = argv[i];
+		if (option == "--cache") {
+			cacheCapacity = static_cast<size_t>(std::atoi(argv[i + 1]));
+		}
+		else if (option == "--threads") {
+			threads = static_cast<size_t>(std::atoi(argv[i + 1]));
+		}
+	}
+	ParseServer server(argv[2], threads, cacheCapacity);
+	return server.run() ? 0 : 1;
+#endif
+}
+
+// Summarizes files in parallel and applies them to the index; unreadable files are dropped from it
+static size_t indexFiles(ProjectIndex& index, const std::vector<std::string>& files) {
+	std::vector<PackageSummary> summaries(files.size());
+	std::vector<uint8_t> loaded(files.size(), 0);
+	parallelFor(files.size(), [&](size_t i) {
+		loaded[i] = summarizePackage(files[i], summaries[i]);
+	});
+	size_t count = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (loaded[i]) {
+			index.update(files[i], summaries[i]);
+			++count;
+		}
+		else {
+			index.remove(files[i]);
+		}
+	}
+	return count;
+}
+
+// UEParser --watch <ContentDir>
+// Indexes every package, then keeps the name, class and dependency indexes current as files
+// change. Queries are read from stdin: name <Name>, class <Class>, deps <Package>, quit.
+int runWatchMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --watch <ContentDir>" << std::endl;
+		return 1;
+	}
+#ifndef __linux__
+	std::cerr << "--watch uses inotify and is only available on Linux" << std::endl;
+	return 1;
+#else
+	std::string root = argv[2];
+	while (root.size() > 1 && root.back() == '/') {
+		root.pop_back();
+	}
+	DirectoryWatcher watcher;
+	if (!watcher.open(root)) {
+		std::cerr << "Cannot watch " << root << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	ProjectIndex index;
+	// Sorted asset paths under root, kept current from the events so an overflow relisting
+	// can tell which files went away
+	std::vector<std::string> files = collectAssetFiles(root);
+	size_t indexed = indexFiles(index, files);
+	std::cout << "Indexed " << indexed << " of " << files.size() << " files in " << elapsedMs(start) << " ms" << std::endl;
+
+	pollfd fds[2] = { { watcher.fd(), POLLIN, 0 }, { STDIN_FILENO, POLLIN, 0 } };
+	nfds_t watched = 2;
+	std::string input;
+	while (true) {
+		if (::poll(fds, watched, -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		if (fds[0].revents & POLLIN) {
+			bool overflowed = false;
+			std::vector<DirectoryWatcher::Change> changes = watcher.read(overflowed);
+			start = std::chrono::steady_clock::now();
+			if (overflowed) {
+				// Events were lost; compare against a fresh listing
+				std::vector<std::string> current = collectAssetFiles(root);
+				for (const std::string& file : files) {
+					if (!std::binary_search(current.begin(), current.end(), file)) {
+						index.remove(file);
+					}
+				}
+				files = current;
+				indexed = indexFiles(index, files);
+				std::cout << "Event queue overflowed; reindexed " << indexed << " files in " << elapsedMs(start) << " ms" << std::endl;
+				continue;
+			}
+			std::vector<std::string> changed;
+			for (const DirectoryWatcher::Change& change : changes) {
+				if (change.directory) {
+					const std::string prefix = change.path + "/";
+					auto first = std::lower_bound(files.begin(), files.end(), prefix);
+					auto last = first;
+					for (; last != files.end() && last->compare(0, prefix.size(), prefix) == 0; ++last) {
+						index.remove(*last);
+					}
+					std::cout << "Removed " << (last - first) << " files under " << change.path << std::endl;
+					files.erase(first, last);
+				}
+				else if (change.removed) {
+					index.remove(change.path);
+					auto position = std::lower_bound(files.begin(), files.end(), change.path);
+					if (position != files.end() && *position == change.path) {
+						files.erase(position);
+					}
+					std::cout << "Removed " << change.path << std::endl;
+				}
+				else {
+					changed.push_back(change.path);
+				}
+			}
+			// Additions go last, so a file re-created under a removed directory stays indexed
+			if (!changed.empty()) {
+				indexFiles(index, changed);
+				for (const std::string& path : changed) {
+					std::error_code ec;
+					auto position = std::lower_bound(files.begin(), files.end(), path);
+					if ((position == files.end() || *position != path) && std::filesystem::is_regular_file(path, ec)) {
+						files.insert(position, path);
+					}
+				}
+				std::cout << "Reindexed " << changed.size() << " files in " << elapsedMs(start) << " ms" << std::endl;
+			}
+		}
+		if (watched > 1 && (fds[1].revents & (POLLIN | POLLHUP))) {
+			char buffer[1024];
+			ssize_t length = ::read(STDIN_FILENO, buffer, sizeof(buffer));
+			if (length <= 0) {
+				watched = 1;   // stdin closed; keep watching
+				continue;
+			}
+			input.append(buffer, static_cast<size_t>(length));
+			size_t newline;
+			while ((newline = input.find('\n')) != std::string::npos) {
+				std::string line = input.substr(0, newline);
+				input.erase(0, newline + 1);
+				size_t space = line.find(' ');
+				std::string command = line.substr(0, space);
+				std::string argument = space == std::string::npos ? "" : line.substr(space + 1);
+				if (command == "quit") {
+					return 0;
+				}
+				start = std::chrono::steady_clock::now();
+				std::vector<std::string> result;
+				if (command == "name") {
+					result = index.filesWithName(argument);
+				}
+				else if (command == "class") {
+					result = index.filesWithClass(argument);
+				}
+				else if (command == "deps") {
+					result = index.dependents(argument);
+				}
+				else {
+					std::cout << "Commands: name <Name>, class <Class>, deps <Package>, quit" << std::endl;
+					continue;
+				}
+				std::cout << result.size() << " files (" << elapsedMs(start) << " ms)" << std::endl;
+				for (const std::string& file : result) {
+					std::cout << "  " << file << std::endl;
+				}
+			}
+		}
+	}
+	return 0;
+#endif
+}
+
+// UEParser --reparse <OldFile> <NewFile>
+// Parses the old version, then reparses the new one against it and compares with a full parse.
+int runReparseMode(int argc, char* argv[]) {
+	if (argc < 4) {
+		std::cerr << "Usage: UEParser --reparse <OldFile> <NewFile>" << std::endl;
+		return 1;
+	}
+
+	std::vector<uint8_t> oldBytes;
+	std::vector<uint8_t> newBytes;
+	if (!readFileBytes(argv[2], oldBytes) || !readFileBytes(argv[3], newBytes)) {
+		std::cerr << "Failed to read input files" << std::endl;
+		return 1;
+	}
+	Uasset incremental;
+	incremental.options.verbose = false;
+	incremental.options.readThumbnails = false;
+	incremental.options.sectionChecksums = true;
+	if (!incremental.parse(oldBytes)) {
+		std::cerr << "Failed to parse " << argv[2] << std::endl;
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	bool reparsed = incremental.reparse(newBytes);
+	double reparseMs = elapsedMs(start);
+
+	Uasset full;
+	full.options = incremental.options;
+	start = std::chrono::steady_clock::now();
+	bool parsed = full.parse(newBytes);
+	double parseMs = elapsedMs(start);
+	if (!reparsed || !parsed) {
+		std::cerr << "Failed to parse " << argv[3] << std::endl;
+		return 1;
+	}
+
+	const Uasset::ReparseStats& stats = incremental.lastReparse;
+	std::cout << "Names " << (stats.namesReused ? "reused" : stats.namesAppended ? "appended" : "decoded") << ", imports " << (stats.importsReused ? "reused" : "decoded")
+		<< ", exports reused: " << stats.exportsReused << ", decoded: " << stats.exportsDecoded << std::endl;
+	std::cout << "Reparse " << reparseMs << " ms, full parse " << parseMs << " ms" << std::endl;
+	bool same = incremental.toJson() == full.toJson();
+	std::cout << (same ? "Result matches a full parse" : "Result differs from a full parse") << std::endl;
+	return same ? 0 : 2;
+}
+// UEParser --bench [--names N] [--imports N] [--exports N] [--props N] [--mix bool=W,int=W,array=W,struct=W,guid=W]
+//                  [--array N] [--guids N] [--thumb Bytes] [--padding 0|1] [--chain 0|1] [--iterations N]
+//                  [--file <File>] [--write <File>]
+// Generates a synthetic package (or loads --file) and times the parser's readers on it.
+int runBenchmarkMode(int argc, char* argv[]) {
+	SyntheticAssetGenerator::Config config;
+	size_t iterations = 100;
+	std::string inputPath;
+	std::string outputPath;
+	for (int i = 2; i + 1 < argc; i += 2) {
+		std::string option = argv[i];
+		uint32_t value = static_cast<uint32_t>(std::atoi(argv[i + 1]));
+		if (option == "--names") {
+			config.names = value;
+		}
+		else if (option == "--imports") {
+			config.imports = value;
+		}
+		else if (option == "--exports") {
+			config.exports = value;
+		}
+		else if (option == "--props") {
+			config.properties = value;
+		}
+		else if (option == "--array") {
+			config.arrayLength = value;
+		}
+		else if (option == "--guids") {
+			config.guidsPerMap = value;
+		}
+		else if (option == "--thumb") {
+			config.thumbnailBytes = value;
+		}
+		else if (option == "--padding") {
+			config.paddingTerminator = value != 0;
+		}
+		else if (option == "--chain") {
+			config.outerChain = value != 0;
+		}
+		else if (option == "--iterations") {
+			iterations = value;
+		}
+		else if (option == "--file") {
+			inputPath = argv[i + 1];
+		}
+		else if (option == "--write") {
+			outputPath = argv[i + 1];
+		}
+		else if (option == "--mix") {
+			std::stringstream mix(argv[i + 1]);
+			std::string entry;
+			while (std::getline(mix, entry, ',')) {
+				size_t eq = entry.find('=');
+				std::string kind = entry.substr(0, eq);
+				uint32_t weight = eq == std::string::npos ? 1 : static_cast<uint32_t>(std::atoi(entry.c_str() + eq + 1));
+				if (kind == "bool") {
+					config.boolWeight = weight;
+				}
+				else if (kind == "int") {
+					config.intWeight = weight;
+				}
+				else if (kind == "array") {
+					config.arrayWeight = weight;
+				}
+				else if (kind == "struct") {
+					config.structWeight = weight;
+				}
+				else if (kind == "guid") {
+					config.guidWeight = weight;
+				}
+				else {
+					std::cerr << "Unknown property kind in --mix: " << kind << std::endl;
+					return 1;
+				}
+			}
+		}
+		else {
+			std::cerr << "Unknown option: " << option << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<uint8_t> bytes;
+	if (!inputPath.empty()) {
+		if (!readFileBytes(inputPath, bytes)) {
+			std::cerr << "Failed to read " << inputPath << std::endl;
+			return 1;
+		}
+	}
+	else {
+		bytes = SyntheticAssetGenerator(config).build();
+		// Each body must end on a decoded None tag; padding tags would mean the bodies are misread
+		Uasset check;
+		check.options.verbose = false;
+		check.options.profile = true;
+		if (!check.parse(bytes) || (check.profile.paddingTags != 0 && !config.paddingTerminator)) {
+			std::cerr << "The synthetic package does not parse cleanly" << std::endl;
+			return 1;
+		}
+	}
+	if (!outputPath.empty()) {
+		std::ofstream out(outputPath, std::ios::binary);
+		out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		if (!out) {
+			std::cerr << "Failed to write " << outputPath << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<ParserBenchmark::Result> results;
+	ParserBenchmark benchmark(bytes, iterations);
+	if (!benchmark.run(results)) {
+		std::cerr << "Failed to parse the benchmark package" << std::endl;
+		return 1;
+	}
+	std::cout << "Package: " << bytes.size() << " bytes, " << iterations << " iterations" << std::endl;
+	std::cout << std::left << std::setw(16) << "benchmark" << std::right << std::setw(12) << "us/iter"
+		<< std::setw(12) << "MB/s" << std::setw(14) << "ns/item" << std::endl;
+	for (const ParserBenchmark::Result& result : results) {
+		double perIterationMs = result.totalMs / result.iterations;
+		double seconds = result.totalMs / 1000.0;
+		double megabytes = static_cast<double>(result.bytesPerIteration) * result.iterations / (1024.0 * 1024.0);
+		double items = static_cast<double>(result.itemsPerIteration) * result.iterations;
+		std::cout << std::left << std::setw(16) << result.name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(12) << perIterationMs * 1000.0
+			<< std::setw(12) << (seconds > 0 ? megabytes / seconds : 0.0)
+			<< std::setw(14) << (items > 0 ? result.totalMs * 1e6 / items : 0.0) << std::endl;
+	}
+	return 0;
+}
+
+// UEParser --profile <File|ContentDir> [--summary] [--trace <TraceFile>]
+// Parses with instrumentation on and prints one JSON line per file, then one with the totals.
+// --trace also writes a Chrome trace of the run with a span per file, section and export.
+int runProfileMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --profile <File|ContentDir> [--summary] [--trace <TraceFile>]" << std::endl;
+		return 1;
+	}
+	bool summaryOnly = false;
+	std::string tracePath;
+	for (int i = 3; i < argc; ++i) {
+		std::string option = argv[i];
+		if (option == "--summary") {
+			summaryOnly = true;
+		}
+		else if (option == "--trace" && i + 1 < argc) {
+			tracePath = argv[++i];
+		}
+		else {
+			std::cerr << "Unknown option: " << option << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<std::string> files;
+	if (std::filesystem::is_directory(argv[2])) {
+		files = collectAssetFiles(argv[2]);
+	}
+	else {
+		files.push_back(argv[2]);
+	}
+
+	TraceRecorder trace;
+	auto start = std::chrono::steady_clock::now();
+	std::vector<ParseProfile> profiles(files.size());
+	std::vector<uint8_t> parsed(files.size(), 0);
+	// One parser per worker, so after the first few files the allocation counts show what
+	// parsing itself still allocates
+	parallelForEach<PackageReader>(files.size(), [&](PackageReader& reader, size_t i) {
+		auto fileStart = std::chrono::steady_clock::now();
+		Uasset& uasset = reader.uasset;
+		uasset.options.verbose = false;
+		uasset.options.profile = true;
+		uasset.options.traceSpans = !tracePath.empty();
+		std::vector<uint8_t>& bytes = reader.bytes;
+		bytes.clear();
+		if (readFileBytes(files[i], bytes)) {
+			try {
+				parsed[i] = uasset.parse(bytes);
+			}
+			catch (const std::exception& e) {
+				std::cerr << files[i] << ": " << e.what() << std::endl;
+			}
+		}
+		if (!tracePath.empty()) {
+			trace.addFile(files[i], fileStart, std::chrono::steady_clock::now(), parsed[i] != 0, bytes.size(), uasset.profile.spans);
+			uasset.profile.spans.clear();
+		}
+		profiles[i] = std::move(uasset.profile);
+	});
+	double wallMs = elapsedMs(start);
+
+	ParseProfile total;
+	size_t failed = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		total.merge(profiles[i]);
+		failed += parsed[i] ? 0 : 1;
+		if (!summaryOnly) {
+			std::cout << json{ {"path", files[i]}, {"parsed", parsed[i] != 0}, {"profile", profiles[i].toJson()} }.dump() << std::endl;
+		}
+	}
+	json summary = total.toJson();
+	summary["failed"] = failed;
+	summary["wallMs"] = wallMs;
+	std::cout << json{ {"total", summary} }.dump() << std::endl;
+	if (!tracePath.empty()) {
+		if (!trace.write(tracePath)) {
+			std::cerr << "Failed to write " << tracePath << std::endl;
+			return 1;
+		}
+		std::cerr << "Wrote " << trace.size() << " trace events to " << tracePath << std::endl;
+	}
+	return failed == 0 ? 0 : 2;
+}
+
+static char coverageLetter(UassetData::Export::Coverage kind) {
+	switch (kind) {
+	case UassetData::Export::Coverage::Decoded:
+		return 'D';
+	case UassetData::Export::Coverage::Skipped:
+		return 'S';
+	default:
+		return 'U';
+	}
+}
+
+// UEParser --coverage <File|ContentDir> [--exports] [--top N]
+// Shows which bytes of each export body were decoded (D), skipped (S) or not understood (U),
+// then ranks the unclaimed tags across all files by the bytes left undecoded after them.
+int runCoverageMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --coverage <File|ContentDir> [--exports] [--top N]" << std::endl;
+		return 1;
+	}
+	bool singleFile = !std::filesystem::is_directory(argv[2]);
+	bool printExports = singleFile;
+	size_t top = 20;
+	for (int i = 3; i < argc; ++i) {
+		std::string option = argv[i];
+		if (option == "--exports") {
+			printExports = true;
+		}
+		else if (option == "--top" && i + 1 < argc) {
+			top = static_cast<size_t>(std::atoi(argv[++i]));
+		}
+		else {
+			std::cerr << "Unknown option: " << option << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<std::string> files;
+	if (singleFile) {
+		files.push_back(argv[2]);
+	}
+	else {
+		files = collectAssetFiles(argv[2]);
+	}
+
+	std::vector<std::vector<UassetData::Export>> exports(files.size());
+	std::vector<uint8_t> parsed(files.size(), 0);
+	parallelFor(files.size(), [&](size_t i) {
+		Uasset uasset;
+		uasset.options.verbose = false;
+		uasset.options.readThumbnails = false;
+		uasset.options.coverage = true;
+		std::vector<uint8_t> bytes;
+		try {
+			if (readFileBytes(files[i], bytes) && uasset.parse(bytes)) {
+				parsed[i] = 1;
+				exports[i] = std::move(uasset.data.exports);
+				for (UassetData::Export& exportData : exports[i]) {
+					exportData.chunkData = std::vector<uint8_t>();
+					exportData.properties = std::vector<UassetData::Export::Property>();
+				}
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+		}
+	});
+
+	struct TagCost {
+		uint64_t bytes = 0;
+		uint64_t runs = 0;
+		uint64_t files = 0;
+	};
+	std::unordered_map<std::string, TagCost> unknownCost;
+	uint64_t totals[3] = { 0, 0, 0 };
+	size_t failed = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (!parsed[i]) {
+			std::cerr << files[i] << ": failed to parse" << std::endl;
+			++failed;
+			continue;
+		}
+		if (printExports && !singleFile) {
+			std::cout << files[i] << std::endl;
+		}
+		std::unordered_map<std::string, bool> seenInFile;
+		for (const UassetData::Export& exportData : exports[i]) {
+			uint64_t sums[3] = { 0, 0, 0 };
+			std::string runs;
+			for (const UassetData::Export::CoverageRun& run : exportData.coverage) {
+				sums[static_cast<int>(run.kind)] += run.length;
+				if (run.kind == UassetData::Export::Coverage::Unknown) {
+					TagCost& cost = unknownCost[run.tag];
+					cost.bytes += run.length;
+					++cost.runs;
+					if (!seenInFile[run.tag]) {
+						seenInFile[run.tag] = true;
+						++cost.files;
+					}
+				}
+				if (printExports) {
+					runs += (runs.empty() ? "" : ", ") + std::to_string(run.offset) + "+" + std::to_string(run.length)
+						+ " " + coverageLetter(run.kind) + " " + run.tag;
+				}
+			}
+			for (int k = 0; k < 3; ++k) {
+				totals[k] += sums[k];
+			}
+			if (printExports) {
+				uint64_t size = exportData.serialSize > 0 ? static_cast<uint64_t>(exportData.serialSize) : 0;
+				std::cout << "  [" << exportData.internalIndex << "] " << exportData.objectName << " " << size << " bytes: "
+					<< sums[0] << " decoded, " << sums[1] << " skipped, " << sums[2] << " unknown" << std::endl;
+				if (!runs.empty()) {
+					std::cout << "    " << runs << std::endl;
+				}
+			}
+		}
+	}
+
+	uint64_t covered = totals[0] + totals[1] + totals[2];
+	auto percent = [&](uint64_t bytes) {
+		return covered > 0 ? 100.0 * static_cast<double>(bytes) / static_cast<double>(covered) : 0.0;
+	};
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "Files: " << files.size() - failed << " parsed, " << failed << " failed" << std::endl;
+	std::cout << "Export bytes: " << totals[0] << " decoded (" << percent(totals[0]) << "%), "
+		<< totals[1] << " skipped (" << percent(totals[1]) << "%), "
+		<< totals[2] << " unknown (" << percent(totals[2]) << "%)" << std::endl;
+
+	std::vector<std::pair<std::string, TagCost>> ranked(unknownCost.begin(), unknownCost.end());
+	std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+		return a.second.bytes != b.second.bytes ? a.second.bytes > b.second.bytes : a.first < b.first;
+	});
+	if (ranked.size() > top) {
+		ranked.resize(top);
+	}
+	if (!ranked.empty()) {
+		std::cout << "Unclaimed tags by undecoded bytes:" << std::endl;
+	}
+	for (const auto& entry : ranked) {
+		std::cout << "  " << std::setw(10) << entry.second.bytes << " bytes  " << std::setw(6) << entry.second.runs << " runs  "
+			<< std::setw(5) << entry.second.files << " files  " << (entry.first.empty() ? "<unresolved>" : entry.first) << std::endl;
+	}
+	return failed == 0 ? 0 : 2;
+}
+
+
+// UEParser --verify-names <File|ContentDir>
+// Recomputes the FName hashes saved with each name table and lists the packages where they
+// differ, a sign of a corrupted or hand-edited name table. Only the name tables are read.
+int runVerifyNamesMode(int argc, char* argv[]) {
+	if (argc < 3) {
+		std::cerr << "Usage: UEParser --verify-names <File|ContentDir>" << std::endl;
+		return 1;
+	}
+	bool singleFile = !std::filesystem::is_directory(argv[2]);
+	std::vector<std::string> files;
+	if (singleFile) {
+		files.push_back(argv[2]);
+	}
+	else {
+		files = collectAssetFiles(argv[2]);
+	}
+
+	struct FileCheck {
+		bool loaded = false;
+		size_t names = 0;
+		UassetData::NameIndex::HashCheck check;
+		std::vector<UassetData::Name> mismatched;   // the first few, for the report
+	};
+	const size_t listed = 5;
+	auto start = std::chrono::steady_clock::now();
+	std::vector<FileCheck> checks(files.size());
+	parallelForEach<PackageReader>(files.size(), [&](PackageReader& reader, size_t i) {
+		FileCheck& result = checks[i];
+		reader.bytes.clear();
+		try {
+			if (!loadPackageNames(files[i], reader.uasset, reader.bytes)) {
+				return;
+			}
+		}
+		catch (const std::exception& e) {
+			std::cerr << files[i] << ": " << e.what() << std::endl;
+			return;
+		}
+		const std::vector<UassetData::Name>& names = reader.uasset.data.names;
+		result.loaded = true;
+		result.names = names.size();
+		result.check = UassetData::NameIndex::verifyHashes(names);
+		for (size_t k = 0; k < result.check.mismatches.size() && k < listed; ++k) {
+			result.mismatched.push_back(names[result.check.mismatches[k]]);
+		}
+	});
+	double ms = elapsedMs(start);
+
+	size_t nameTotal = 0;
+	size_t badFiles = 0;
+	size_t failed = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		const FileCheck& result = checks[i];
+		if (!result.loaded) {
+			std::cout << files[i] << ": failed to read name table" << std::endl;
+			++failed;
+			continue;
+		}
+		nameTotal += result.names;
+		badFiles += result.check.mismatches.empty() ? 0 : 1;
+		if (result.check.mismatches.empty() && !singleFile) {
+			continue;
+		}
+		std::cout << files[i] << ": " << result.check.mismatches.size() << " of " << result.check.checked << " names have wrong hashes";
+		if (result.check.skipped > 0) {
+			std::cout << " (" << result.check.skipped << " non-ASCII names not checked)";
+		}
+		std::cout << std::endl;
+		for (size_t k = 0; k < result.mismatched.size(); ++k) {
+			const UassetData::Name& name = result.mismatched[k];
+			uint16_t hash, caseHash;
+			computeNameHashes(name.Name, hash, caseHash);
+			std::cout << "  [" << result.check.mismatches[k] << "] " << name.Name << ": stored " << name.NonCasePreservingHash << "/" << name.CasePreservingHash
+				<< ", expected " << hash << "/" << caseHash << std::endl;
+		}
+		if (result.check.mismatches.size() > result.mismatched.size()) {
+			std::cout << "  ..." << std::endl;
+		}
+	}
+	std::cout << "Verified " << nameTotal << " names in " << files.size() - failed << " files in " << ms << " ms: "
+		<< badFiles << " with wrong hashes, " << failed << " unreadable" << std::endl;
+	return badFiles == 0 && failed == 0 ? 0 : 2;
+}
+
+#ifdef UEPARSER_FUZZ
+// Fuzzing entry point for libFuzzer (clang++ -g -O1 -fsanitize=fuzzer,address -DUEPARSER_FUZZ UEParser.cpp)
+// and AFL++ (afl-clang-fast++ with the same flags). The work budgets in ParseOptions keep every
+// input bounded, so a timeout or out-of-memory report is a bug in one of them. fuzz/seeds holds
+// shapes that once escaped them; larger copies come from
+// UEParser --bench --props 0 --exports <N> --padding 1 (or --chain 1) --write <File>.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	std::vector<uint8_t> bytes(data, data + size);
+	Uasset uasset;
+	uasset.options.verbose = false;
+	uasset.options.readAssetRegistry = true;
+	uasset.options.coverage = true;
+	if (uasset.parse(bytes)) {
+		uasset.softObjectPaths();
+		uasset.softPackageReferences();
+		uasset.searchableNames();
+		uasset.toJson().dump(-1, ' ', false, json::error_handler_t::replace);
+	}
+	return 0;
+}
+
+#ifdef UEPARSER_FUZZ_MAIN
+// Replays inputs without a fuzzing engine: each argument is a file, or stdin when there are none
+int main(int argc, char* argv[]) {
+	std::vector<uint8_t> bytes;
+	if (argc < 2) {
+		bytes.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+		return LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+	}
+	for (int i = 1; i < argc; ++i) {
+		if (readFileBytes(argv[i], bytes)) {
+			LLVMFuzzerTestOneInput(bytes.data(), bytes.size());
+		}
+	}
+	return 0;
+}
+#endif
+#else
+
+
+int main(int argc, char* argv[]) {
+	std::string mode = argc > 1 ? argv[1] : "";
+	if (mode == "--deps") {
+		return runDependencyMode(argc, argv);
+	}
+	if (mode == "--load-order") {
+		return runLoadOrderMode(argc, argv);
+	}
+	if (mode == "--tags") {
+		return runTagIndexMode(argc, argv);
+	}
+	if (mode == "--find-exports") {
+		return runExportQueryMode(argc, argv);
+	}
+	if (mode == "--thumbnails") {
+		return runThumbnailDumpMode(argc, argv);
+	}
+	if (mode == "--patch") {
+		return runPatchMode(argc, argv);
+	}
+	if (mode == "--resave") {
+		return runResaveMode(argc, argv);
+	}
+	if (mode == "--diff") {
+		return runDiffMode(argc, argv);
+	}
+	if (mode == "--graph") {
+		return runBlueprintGraphMode(argc, argv);
+	}
+	if (mode == "--disasm") {
+		return runDisassemblerMode(argc, argv);
+	}
+	if (mode == "--find-name") {
+		return runNameSearchMode(argc, argv);
+	}
+	if (mode == "--serve") {
+		return runServerMode(argc, argv);
+	}
+	if (mode == "--watch") {
+		return runWatchMode(argc, argv);
+	}
+	if (mode == "--reparse") {
+		return runReparseMode(argc, argv);
+	}
+	if (mode == "--bench") {
+		return runBenchmarkMode(argc, argv);
+	}
+	if (mode == "--profile") {
+		return runProfileMode(argc, argv);
+	}
+	if (mode == "--coverage") {
+		return runCoverageMode(argc, argv);
+	}
+	if (mode == "--verify-names") {
+		return runVerifyNamesMode(argc, argv);
+	}
+
+	//    std::ifstream file("C:/Users/kapis/Downloads/Blueprint/BP_FrontEndPlayerController.uasset", std::ios::binary);
+	std::string path = argc > 1 ? argv[1] : "C:/Users/kapis/Downloads/Blueprint/BP_SandWorldPlayerController.uasset";
+	std::ifstream file(path, std::ios::binary);
+	//    std::ifstream file("C:/Users/kapis/Downloads/Blueprint/BP_SaveGameState.uasset", std::ios::binary);
+	 
+
+	if (!file) {
+		std::cerr << "Failed to open file" << std::endl;
+		return 1;
+	}
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	Uasset uasset;
+	if (!uasset.parse(bytes)) {
+		std::cerr << "Failed to parse uasset file" << std::endl;
+		return 1;
+	}
+
+	uasset.softObjectPaths();
+	uasset.softPackageReferences();
+	uasset.searchableNames();
+
+	// Print parsed data
+	printUassetData(uasset.data);
+
+	// Convert to JSON
+	json j = uasset.toJson();
+	std::cout << j.dump(4) << std::endl;
+
+	return 0;
+}
+#endif